@@ -11,22 +11,16 @@ public class DebugPrint : ModuleRules
 		PublicDependencyModuleNames.AddRange(new string[]
 		{
 			"Core",
-			"CoreUObject",
-			"Engine"
-		});
-	
-		PrivateDependencyModuleNames.AddRange(new string[]
-		{
 			"CoreUObject",
 			"Engine",
-			"Slate",
-			"SlateCore",
-			"BlueprintGraph",
-			"KismetCompiler",
-			"GraphEditor",
-			"UnrealEd",
-			"ToolMenus",
-			"DeveloperSettings"
+			"DeveloperSettings",
+			"SlateCore"
 		});
+
+		// Stripping reads the packaging settings while Blueprints compile
+		if (target.bBuildEditor)
+		{
+			PrivateDependencyModuleNames.Add("DeveloperToolSettings");
+		}
 	}
 }
@@ -1,34 +1,36 @@
 // Copyright MoxAlehin. All Rights Reserved.
 
 #include "DebugPrint.h"
-#include "DebugPrintDeveloperSettings.h"
-#include "ISettingsModule.h"
+#include "DebugPrintQueue.h"
+#include "DebugPrintRecorder.h"
+#include "DebugPrintRenderer.h"
+#include "DebugPrintStats.h"
+#include "DebugPrintWatch.h"
+#include "Misc/CommandLine.h"
 #define LOCTEXT_NAMESPACE "FDebugPrintModule"
 
-class UDebugPrintDeveloperSettings;
-class ISettingsModule;
+DEFINE_LOG_CATEGORY(LogDebugPrint);
 
 void FDebugPrintModule::StartupModule()
 {
-	if (ISettingsModule* SettingsModule = FModuleManager::GetModulePtr<ISettingsModule>("Settings"))
+	FDebugPrintRenderer::Get().Register();
+	FDebugPrintQueue::Get().Initialize();
+	DebugPrintStats::Register();
+	FDebugPrintWatch::Get().Register();
+
+	if (FParse::Param(FCommandLine::Get(), TEXT("DebugPrintRecord")))
 	{
-		SettingsModule->RegisterSettings(
-			"Editor",
-			"Plugins",
-			"Debug Print",
-			NSLOCTEXT("DebugPrint", "Debug Print Plugin Settings", "Debug Print"),
-			NSLOCTEXT("DebugPrint", "Debug Print Plugin Settings Description", "Debug Print Settings"),
-			GetMutableDefault<UDebugPrintDeveloperSettings>()  // Указатель на класс настроек
-		);
+		FDebugPrintRecorder::Get().Start();
 	}
 }
 
 void FDebugPrintModule::ShutdownModule()
 {
-	if (ISettingsModule* SettingsModule = FModuleManager::GetModulePtr<ISettingsModule>("Settings"))
-	{
-		SettingsModule->UnregisterSettings("Editor", "Plugins", "Debug Print");
-	}
+	FDebugPrintRecorder::Get().Stop();
+	FDebugPrintQueue::Get().Shutdown();
+	FDebugPrintWatch::Get().Unregister();
+	DebugPrintStats::Unregister();
+	FDebugPrintRenderer::Get().Unregister();
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,422 @@
+// Copyright MoxAlehin. All Rights Reserved.
+
+#include "DebugPrintCaptureReader.h"
+
+#include "Algo/BinarySearch.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/Compression.h"
+#include "DebugPrintRecorder.h"
+
+namespace DebugPrintCaptureReader
+{
+    using namespace DebugPrintCapture;
+
+    // Reads little endian data from a record without trusting its sizes
+    struct FCursor
+    {
+        const uint8* Position = nullptr;
+        const uint8* End = nullptr;
+
+        template <typename T>
+        bool Read(T& Out)
+        {
+            if (End - Position < static_cast<int64>(sizeof(T)))
+            {
+                return false;
+            }
+            FMemory::Memcpy(&Out, Position, sizeof(T));
+            Position += sizeof(T);
+            return true;
+        }
+
+        bool ReadString(FString& Out)
+        {
+            uint16 Length = 0;
+            if (!Read(Length) || End - Position < Length)
+            {
+                return false;
+            }
+            const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Position), Length);
+            Out = FString(Converted.Length(), Converted.Get());
+            Position += Length;
+            return true;
+        }
+    };
+
+    struct FRecordHeader
+    {
+        uint32 Size = 0;
+        ERecordType Type = ERecordType::Values;
+        FGuid NodeGuid;
+        uint64 Frame = 0;
+        double Time = 0.0;
+    };
+
+    // Reads the header of the record at the cursor and moves the cursor to its payload
+    bool ReadRecordHeader(FCursor& Cursor, FRecordHeader& OutHeader)
+    {
+        const uint8* RecordStart = Cursor.Position;
+        if (!Cursor.Read(OutHeader.Size) || !Cursor.Read(OutHeader.Type) || !Cursor.Read(OutHeader.NodeGuid) ||
+            !Cursor.Read(OutHeader.Frame) || !Cursor.Read(OutHeader.Time))
+        {
+            return false;
+        }
+        return OutHeader.Size >= static_cast<uint32>(RecordHeaderSize) && Cursor.End - RecordStart >= OutHeader.Size;
+    }
+
+    // Appends the text the overlay showed for a recorded value, in the number format of its pin
+    bool ReadValue(FCursor& Cursor, const FDebugPrintNumberFormat& Format, FString& Out)
+    {
+        EValueType Type;
+        if (!Cursor.Read(Type))
+        {
+            return false;
+        }
+
+        switch (Type)
+        {
+        case EValueType::String:
+        {
+            FString Text;
+            if (!Cursor.ReadString(Text)) return false;
+            Out += Text;
+            return true;
+        }
+        case EValueType::Bool:
+        {
+            uint8 Value = 0;
+            if (!Cursor.Read(Value)) return false;
+            Out += Value ? TEXT("true") : TEXT("false");
+            return true;
+        }
+        case EValueType::Int:
+        {
+            int64 Value = 0;
+            if (!Cursor.Read(Value)) return false;
+            FDebugPrintFormatter::AppendInteger(Out, Value, Format);
+            return true;
+        }
+        case EValueType::Double:
+        {
+            double Value = 0.0;
+            if (!Cursor.Read(Value)) return false;
+            FDebugPrintFormatter::AppendDouble(Out, Value, Format);
+            return true;
+        }
+        case EValueType::Vector:
+        {
+            FVector Value;
+            if (!Cursor.Read(Value.X) || !Cursor.Read(Value.Y) || !Cursor.Read(Value.Z)) return false;
+            FDebugPrintFormatter::AppendVector(Out, Value, Format);
+            return true;
+        }
+        case EValueType::Rotator:
+        {
+            FRotator Value;
+            if (!Cursor.Read(Value.Pitch) || !Cursor.Read(Value.Yaw) || !Cursor.Read(Value.Roll)) return false;
+            FDebugPrintFormatter::AppendRotator(Out, Value, Format);
+            return true;
+        }
+        default:
+            return false;
+        }
+    }
+
+    // Reads the layout of a node record. Captures of version 1 only hold the labels
+    void ReadNode(FCursor& Cursor, uint32 FileVersion, FDebugPrintCaptureNode& Node)
+    {
+        uint8 PrintType = uint8(EPrintType::PrintInColumns);
+        ENodeFlags Flags = ENodeFlags::None;
+        if (FileVersion >= 2 && (!Cursor.Read(PrintType) || !Cursor.Read(Flags) || !Cursor.ReadString(Node.Separator)))
+        {
+            return;
+        }
+        Node.PrintType = EPrintType(PrintType);
+        Node.bSeparatorInLayout = EnumHasAnyFlags(Flags, ENodeFlags::SeparatorInLayout);
+
+        uint16 NumValues = 0;
+        Cursor.Read(NumValues);
+        Node.Labels.Reset(NumValues);
+        Node.LabelPrefixes.Reset(NumValues);
+        Node.NumberFormats.Reset(NumValues);
+        for (int32 Index = 0; Index < NumValues; ++Index)
+        {
+            FString& Label = Node.Labels.AddDefaulted_GetRef();
+            FString& LabelPrefix = Node.LabelPrefixes.AddDefaulted_GetRef();
+            FDebugPrintNumberFormat& Format = Node.NumberFormats.AddDefaulted_GetRef();
+            if (!Cursor.ReadString(Label))
+            {
+                return;
+            }
+            if (FileVersion < 2)
+            {
+                LabelPrefix = Label;
+                continue;
+            }
+
+            int8 Precision = -1;
+            uint8 MinWidth = 0;
+            if (!Cursor.ReadString(LabelPrefix) || !Cursor.Read(Precision) || !Cursor.Read(MinWidth))
+            {
+                return;
+            }
+            Format.Precision = Precision;
+            Format.MinWidth = MinWidth;
+        }
+    }
+}
+
+FDebugPrintCaptureReader::FDebugPrintCaptureReader() = default;
+
+FDebugPrintCaptureReader::~FDebugPrintCaptureReader()
+{
+    Close();
+}
+
+bool FDebugPrintCaptureReader::Open(const FString& InPath, FString& OutError)
+{
+    using namespace DebugPrintCaptureReader;
+    Close();
+
+    MappedFile.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*InPath));
+    if (!MappedFile || MappedFile->GetFileSize() < static_cast<int64>(sizeof(uint32) * 2))
+    {
+        OutError = FString::Printf(TEXT("Can't map %s"), *InPath);
+        Close();
+        return false;
+    }
+
+    MappedRegion.Reset(MappedFile->MapRegion(0, MappedFile->GetFileSize()));
+    if (!MappedRegion)
+    {
+        OutError = FString::Printf(TEXT("Can't map %s"), *InPath);
+        Close();
+        return false;
+    }
+
+    Path = InPath;
+    Data = MappedRegion->GetMappedPtr();
+    Size = MappedRegion->GetMappedSize();
+
+    FCursor Cursor{Data, Data + Size};
+    uint32 FileMagic = 0;
+    if (!Cursor.Read(FileMagic) || !Cursor.Read(FileVersion) || FileMagic != Magic || FileVersion < 1 || FileVersion > Version)
+    {
+        OutError = FString::Printf(TEXT("%s is not a DebugPrint capture of version %u or older"), *InPath, Version);
+        Close();
+        return false;
+    }
+
+    // Index the chunks from their headers. A capture cut off by a crash ends at its last complete chunk
+    while (Cursor.End - Cursor.Position >= ChunkHeaderSize)
+    {
+        FChunk Chunk;
+        Cursor.Read(Chunk.UncompressedSize);
+        Cursor.Read(Chunk.CompressedSize);
+        Cursor.Read(Chunk.FirstFrame);
+        Cursor.Read(Chunk.LastFrame);
+        if (Cursor.End - Cursor.Position < Chunk.CompressedSize)
+        {
+            break;
+        }
+
+        Chunk.DataOffset = Cursor.Position - Data;
+        Cursor.Position += Chunk.CompressedSize;
+        Chunks.Add(Chunk);
+    }
+
+    if (Chunks.Num() > 0)
+    {
+        FirstFrame = Chunks[0].FirstFrame;
+        LastFrame = Chunks.Last().LastFrame;
+    }
+
+    // Index the nodes with a single pass over the records
+    for (int32 ChunkIndex = 0; ChunkIndex < Chunks.Num(); ++ChunkIndex)
+    {
+        const TConstArrayView<uint8> Records = GetChunkRecords(ChunkIndex);
+        FCursor RecordCursor{Records.GetData(), Records.GetData() + Records.Num()};
+
+        FRecordHeader Header;
+        for (const uint8* RecordStart = RecordCursor.Position; ReadRecordHeader(RecordCursor, Header);
+             RecordStart += Header.Size, RecordCursor.Position = RecordStart)
+        {
+            int32& NodeIndex = NodeIndices.FindOrAdd(Header.NodeGuid, INDEX_NONE);
+            if (NodeIndex == INDEX_NONE)
+            {
+                NodeIndex = Nodes.Num();
+                Nodes.AddDefaulted_GetRef().NodeGuid = Header.NodeGuid;
+                NodeChunks.AddDefaulted();
+            }
+
+            FDebugPrintCaptureNode& Node = Nodes[NodeIndex];
+            if (Header.Type == ERecordType::Node)
+            {
+                ReadNode(RecordCursor, FileVersion, Node);
+                continue;
+            }
+
+            TArray<FNodeChunk>& Entries = NodeChunks[NodeIndex];
+            if (Entries.Num() == 0 || Entries.Last().Chunk != ChunkIndex)
+            {
+                Entries.Add({ChunkIndex, Header.Frame});
+            }
+            Node.FirstFrame = FMath::Min(Node.FirstFrame, Header.Frame);
+            Node.LastFrame = FMath::Max(Node.LastFrame, Header.Frame);
+        }
+    }
+
+    return true;
+}
+
+void FDebugPrintCaptureReader::Close()
+{
+    CachedChunks.Reset();
+    Nodes.Reset();
+    NodeChunks.Reset();
+    NodeIndices.Reset();
+    Chunks.Reset();
+    FirstFrame = 0;
+    LastFrame = 0;
+    FileVersion = 0;
+
+    Data = nullptr;
+    Size = 0;
+    MappedRegion.Reset();
+    MappedFile.Reset();
+    Path.Reset();
+}
+
+void FDebugPrintCaptureReader::Seek(uint64 Frame, TArray<FDebugPrintCaptureTable>& OutTables)
+{
+    using namespace DebugPrintCaptureReader;
+    OutTables.Reset();
+
+    // The last chunk in which a node printed at or before the frame holds the record to show
+    TArray<int32> ChunkOfNode;
+    ChunkOfNode.Init(INDEX_NONE, Nodes.Num());
+    TArray<int32> ChunksToRead;
+    for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); ++NodeIndex)
+    {
+        const TArray<FNodeChunk>& Entries = NodeChunks[NodeIndex];
+        const int32 Found = Algo::UpperBoundBy(Entries, Frame, &FNodeChunk::FirstFrame) - 1;
+        if (Entries.IsValidIndex(Found))
+        {
+            ChunkOfNode[NodeIndex] = Entries[Found].Chunk;
+            ChunksToRead.AddUnique(Entries[Found].Chunk);
+        }
+    }
+    ChunksToRead.Sort();
+
+    TArray<int32> TableOfNode;
+    TableOfNode.Init(INDEX_NONE, Nodes.Num());
+    for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); ++NodeIndex)
+    {
+        if (ChunkOfNode[NodeIndex] != INDEX_NONE)
+        {
+            TableOfNode[NodeIndex] = OutTables.Num();
+            OutTables.AddDefaulted_GetRef().NodeGuid = Nodes[NodeIndex].NodeGuid;
+        }
+    }
+
+    // Every chunk is read once for all nodes that need it. Records are in frame order, so reading stops past the frame
+    TArray<const uint8*> LatestRecords;
+    for (const int32 ChunkIndex : ChunksToRead)
+    {
+        LatestRecords.Init(nullptr, Nodes.Num());
+
+        const TConstArrayView<uint8> Records = GetChunkRecords(ChunkIndex);
+        FCursor Cursor{Records.GetData(), Records.GetData() + Records.Num()};
+
+        FRecordHeader Header;
+        for (const uint8* RecordStart = Cursor.Position; ReadRecordHeader(Cursor, Header) && Header.Frame <= Frame;
+             RecordStart += Header.Size, Cursor.Position = RecordStart)
+        {
+            const int32* NodeIndex = NodeIndices.Find(Header.NodeGuid);
+            if (Header.Type == ERecordType::Values && NodeIndex && ChunkOfNode[*NodeIndex] == ChunkIndex)
+            {
+                LatestRecords[*NodeIndex] = RecordStart;
+            }
+        }
+
+        for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); ++NodeIndex)
+        {
+            if (!LatestRecords[NodeIndex])
+            {
+                continue;
+            }
+
+            FCursor RecordCursor{LatestRecords[NodeIndex], Cursor.End};
+            ReadRecordHeader(RecordCursor, Header);
+            RecordCursor.End = LatestRecords[NodeIndex] + Header.Size;
+
+            FDebugPrintCaptureTable& Table = OutTables[TableOfNode[NodeIndex]];
+            Table.Frame = Header.Frame;
+            Table.Time = Header.Time;
+
+            // Values are laid out like PrintValues lays them out on the overlay
+            const FDebugPrintCaptureNode& Node = Nodes[NodeIndex];
+            const bool bSingleLine = Node.PrintType == EPrintType::PrintInline || Node.PrintType == EPrintType::PrintReplace;
+            const bool bLabelColumn = !bSingleLine && Node.PrintType != EPrintType::PrintLabels;
+
+            uint16 NumValues = 0;
+            RecordCursor.Read(NumValues);
+            for (int32 Index = 0; Index < NumValues; ++Index)
+            {
+                const FDebugPrintNumberFormat Format = Node.NumberFormats.IsValidIndex(Index) ? Node.NumberFormats[Index] : FDebugPrintNumberFormat();
+                if (bSingleLine && Table.Values.Num() > 0)
+                {
+                    Table.Values[0] += Node.Separator;
+                }
+                else
+                {
+                    Table.Labels.Add(bLabelColumn && Node.Labels.IsValidIndex(Index) ? Node.Labels[Index] : FString());
+                    Table.Values.AddDefaulted();
+                    if (!bLabelColumn && !bSingleLine && Node.LabelPrefixes.IsValidIndex(Index))
+                    {
+                        Table.Values.Last() += Node.LabelPrefixes[Index];
+                        if (!Node.bSeparatorInLayout) Table.Values.Last() += Node.Separator;
+                    }
+                }
+
+                if (!ReadValue(RecordCursor, Format, Table.Values.Last()))
+                {
+                    break;
+                }
+            }
+        }
+    }
+}
+
+TConstArrayView<uint8> FDebugPrintCaptureReader::GetChunkRecords(int32 ChunkIndex)
+{
+    const FChunk& Chunk = Chunks[ChunkIndex];
+    const uint8* Source = Data + Chunk.DataOffset;
+    if (Chunk.CompressedSize == Chunk.UncompressedSize)
+    {
+        return MakeArrayView(Source, Chunk.UncompressedSize);
+    }
+
+    for (const TPair<int32, TArray<uint8>>& Cached : CachedChunks)
+    {
+        if (Cached.Key == ChunkIndex)
+        {
+            return Cached.Value;
+        }
+    }
+
+    // The oldest chunk makes room. Views into the other chunks stay valid, their memory doesn't move
+    if (CachedChunks.Num() >= MaxCachedChunks)
+    {
+        CachedChunks.RemoveAt(0);
+    }
+
+    TPair<int32, TArray<uint8>>& Cached = CachedChunks.Emplace_GetRef(ChunkIndex, TArray<uint8>());
+    Cached.Value.SetNumUninitialized(Chunk.UncompressedSize);
+    if (!FCompression::UncompressMemory(NAME_Zlib, Cached.Value.GetData(), Chunk.UncompressedSize, Source, Chunk.CompressedSize))
+    {
+        Cached.Value.Reset();
+    }
+    return Cached.Value;
+}
@@ -0,0 +1,149 @@
+// Copyright MoxAlehin. All Rights Reserved.
+
+#include "DebugPrintCategories.h"
+
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
+#include "DebugPrint.h"
+
+namespace DebugPrintCategories
+{
+    bool bEnableValue = true;
+
+    FAutoConsoleVariableRef EnableVariable(TEXT("DebugPrint.Enable"), bEnableValue,
+        TEXT("Enables DebugPrint output. Disabled nodes skip evaluating their values."),
+        FConsoleVariableDelegate::CreateLambda([](IConsoleVariable* Variable)
+        {
+            FDebugPrintCategories::Get().SetPrintingEnabled(Variable->GetBool());
+        }));
+
+    FAutoConsoleCommand FilterCommand(TEXT("DebugPrint.Filter"),
+        TEXT("Shows only the listed DebugPrint categories, e.g. DebugPrint.Filter Movement,AI. Categories starting with '-' ")
+        TEXT("are hidden instead. Without arguments every category is shown."),
+        FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+        {
+            FDebugPrintCategories::Get().SetFilter(FString::Join(Args, TEXT(",")));
+        }));
+}
+
+FDebugPrintCategories& FDebugPrintCategories::Get()
+{
+    static FDebugPrintCategories Categories;
+    return Categories;
+}
+
+FDebugPrintCategories::FDebugPrintCategories()
+{
+    for (std::atomic<uint64>& Word : Bits)
+    {
+        Word.store(0, std::memory_order_relaxed);
+    }
+}
+
+int32 FDebugPrintCategories::FindOrAddIndex(FName Category)
+{
+    if (Category.IsNone())
+    {
+        return INDEX_NONE;
+    }
+
+    FScopeLock Lock(&Mutex);
+    for (int32 Index = 0; Index < NumCategories; ++Index)
+    {
+        if (Names[Index] == Category)
+        {
+            return Index;
+        }
+    }
+
+    if (NumCategories == MaxCategories)
+    {
+        UE_LOG(LogDebugPrint, Warning, TEXT("DebugPrint category %s can't be filtered, all %d categories are in use"),
+            *Category.ToString(), MaxCategories);
+        return INDEX_NONE;
+    }
+
+    // A new category is filtered like the categories that aren't listed
+    const int32 Index = NumCategories++;
+    Names[Index] = Category;
+    if (bDefaultEnabled.load(std::memory_order_relaxed))
+    {
+        Bits[Index >> 6].fetch_or(uint64(1) << (Index & 63), std::memory_order_relaxed);
+    }
+    return Index;
+}
+
+bool FDebugPrintCategories::IsEnabled(FName Category)
+{
+    check(IsInGameThread());
+    if (Category.IsNone())
+    {
+        return IsEnabled(INDEX_NONE);
+    }
+
+    const int32* Index = GameThreadIndices.Find(Category);
+    return IsEnabled(Index ? *Index : GameThreadIndices.Add(Category, FindOrAddIndex(Category)));
+}
+
+void FDebugPrintCategories::SetPrintingEnabled(bool bInEnabled)
+{
+    bEnabled.store(bInEnabled, std::memory_order_relaxed);
+}
+
+void FDebugPrintCategories::SetFilter(const FString& InFilter)
+{
+    TArray<FString> Entries;
+    InFilter.ParseIntoArray(Entries, TEXT(","));
+
+    TArray<FName> Shown;
+    TArray<FName> Hidden;
+    for (FString& Entry : Entries)
+    {
+        Entry.TrimStartAndEndInline();
+        if (Entry.RemoveFromStart(TEXT("-")))
+        {
+            Hidden.Add(FName(*Entry));
+        }
+        else if (!Entry.IsEmpty())
+        {
+            Shown.Add(FName(*Entry));
+        }
+    }
+
+    // Listing categories hides everything else, hiding categories keeps everything else
+    const bool bShowUnlisted = Shown.Num() == 0;
+    uint64 NewBits[MaxCategories / 64];
+    FMemory::Memset(NewBits, bShowUnlisted ? 0xFF : 0, sizeof(NewBits));
+
+    auto SetBit = [&NewBits](int32 Index, bool bShown)
+    {
+        if (Index != INDEX_NONE)
+        {
+            const uint64 Mask = uint64(1) << (Index & 63);
+            NewBits[Index >> 6] = bShown ? NewBits[Index >> 6] | Mask : NewBits[Index >> 6] & ~Mask;
+        }
+    };
+
+    for (FName Category : Shown)
+    {
+        SetBit(FindOrAddIndex(Category), true);
+    }
+    for (FName Category : Hidden)
+    {
+        SetBit(FindOrAddIndex(Category), false);
+    }
+
+    FScopeLock Lock(&Mutex);
+    bDefaultEnabled.store(bShowUnlisted, std::memory_order_relaxed);
+    for (int32 Word = 0; Word < MaxCategories / 64; ++Word)
+    {
+        Bits[Word].store(NewBits[Word], std::memory_order_relaxed);
+    }
+
+    Filter = FString::JoinBy(Shown, TEXT(","), [](FName Name) { return Name.ToString(); });
+    for (FName Category : Hidden)
+    {
+        Filter += (Filter.IsEmpty() ? TEXT("-") : TEXT(",-")) + Category.ToString();
+    }
+    UE_LOG(LogDebugPrint, Display, TEXT("DebugPrint filter: %s"), Filter.IsEmpty() ? TEXT("all categories") : *Filter);
+}
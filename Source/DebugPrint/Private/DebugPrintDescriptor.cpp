@@ -0,0 +1,208 @@
+// Copyright MoxAlehin. All Rights Reserved.
+
+#include "DebugPrintDescriptor.h"
+
+namespace DebugPrintDescriptor
+{
+    // Flags of the node, stored as a single digit at the start of the layout
+    constexpr uint8 SeparatorInLayoutFlag = 1 << 0;
+    constexpr uint8 PrintOnChangeFlag = 1 << 1;
+
+    // Blueprints only call DebugPrint from the game thread, so the cache needs no locking. Node GUIDs survive
+    // duplicating a Blueprint, so every compiled copy of a node is told apart by the address of its layout in the
+    // bytecode. Native callers pass no address and share the entry of their GUID. Descriptors are boxed, so the
+    // one in use stays put while other nodes are added
+    TMap<TPair<FGuid, const uint8*>, TUniquePtr<FDebugPrintNodeDescriptor>> Descriptors;
+
+    void AppendText(FString& Layout, const FString& Text)
+    {
+        Layout.AppendInt(Text.Len());
+        Layout.AppendChar(TEXT(':'));
+        Layout += Text;
+    }
+
+    // Appends the text of a literal, or '*' for a field read from the Blueprint frame
+    void AppendField(FString& Layout, const TOptional<FString>& Literal)
+    {
+        if (Literal.IsSet())
+        {
+            AppendText(Layout, Literal.GetValue());
+        }
+        else
+        {
+            Layout.AppendChar(TEXT('*'));
+        }
+    }
+}
+
+FString FDebugPrintNodeDescriptor::EncodeLayout(
+    const FDebugPrintOptionsLayout& InOptions, const TArray<FDebugPrintValueLayout>& InValues)
+{
+    using namespace DebugPrintDescriptor;
+
+    FString Layout;
+    // Exactly one character, so the length of the Key that follows can't run into the flags
+    const uint8 Flags = (InOptions.bSeparatorInLayout ? SeparatorInLayoutFlag : 0) | (InOptions.bPrintOnChange ? PrintOnChangeFlag : 0);
+    Layout.AppendChar(TCHAR(TEXT('0') + Flags));
+
+    // The options come first, in the order of their variadic arguments
+    AppendField(Layout, InOptions.Key);
+    AppendField(Layout, InOptions.Separator);
+    AppendField(Layout, InOptions.TextColor);
+    AppendField(Layout, InOptions.Duration);
+    AppendField(Layout, InOptions.PrintType);
+
+    // Every value is its label and prefix, its number format and its literal. The precision is stored
+    // one higher, so the default of -1 is written as a plain digit like every other number
+    for (const FDebugPrintValueLayout& Value : InValues)
+    {
+        AppendText(Layout, Value.Label);
+        AppendText(Layout, Value.LabelPrefix);
+        Layout.AppendInt(FMath::Max(Value.NumberFormat.Precision + 1, 0));
+        Layout.AppendChar(TEXT(','));
+        Layout.AppendInt(FMath::Max(Value.NumberFormat.MinWidth, 0));
+        Layout.AppendChar(TEXT(','));
+        AppendField(Layout, Value.Literal);
+    }
+    return Layout;
+}
+
+int32 FDebugPrintNodeDescriptor::HashLayout(const FString& Layout)
+{
+    return static_cast<int32>(FCrc::StrCrc32(*Layout));
+}
+
+const FDebugPrintNodeDescriptor* FDebugPrintNodeDescriptor::Find(const FGuid& NodeGuid, int32 LayoutHash, const uint8* LayoutCode)
+{
+    // The same hash at the same address of the same bytecode can only be the layout the descriptor was decoded from
+    if (!LayoutCode)
+    {
+        return nullptr;
+    }
+
+    const TUniquePtr<FDebugPrintNodeDescriptor>* Descriptor =
+        DebugPrintDescriptor::Descriptors.Find(TPair<FGuid, const uint8*>(NodeGuid, LayoutCode));
+    return Descriptor && (*Descriptor)->SourceLayoutHash == LayoutHash ? Descriptor->Get() : nullptr;
+}
+
+const FDebugPrintNodeDescriptor& FDebugPrintNodeDescriptor::Get(
+    const FGuid& NodeGuid, const FString& Layout, int32 LayoutHash, const uint8* LayoutCode)
+{
+    TUniquePtr<FDebugPrintNodeDescriptor>& DescriptorPtr =
+        DebugPrintDescriptor::Descriptors.FindOrAdd(TPair<FGuid, const uint8*>(NodeGuid, LayoutCode));
+    if (!DescriptorPtr) DescriptorPtr = MakeUnique<FDebugPrintNodeDescriptor>();
+
+    FDebugPrintNodeDescriptor& Descriptor = *DescriptorPtr;
+    if (Descriptor.GuidKey.IsNone() || !Descriptor.SourceLayout.Equals(Layout, ESearchCase::CaseSensitive))
+    {
+        Descriptor.NodeGuid = NodeGuid;
+        Descriptor.GuidKey = FName(*NodeGuid.ToString());
+        Descriptor.Decode(Layout);
+    }
+    Descriptor.SourceLayoutHash = LayoutHash;
+    return Descriptor;
+}
+
+void FDebugPrintNodeDescriptor::Decode(const FString& Layout)
+{
+    SourceLayout = Layout;
+    Values.Reset();
+    NumDynamicValues = 0;
+    DynamicOptions = EDynamicOption::None;
+
+    int32 Index = 0;
+    auto ReadNumber = [&Layout, &Index]()
+    {
+        int32 Number = 0;
+        while (Index < Layout.Len() && FChar::IsDigit(Layout[Index]))
+        {
+            Number = Number * 10 + (Layout[Index] - TEXT('0'));
+            Index++;
+        }
+        return Number;
+    };
+
+    auto ReadText = [&Layout, &Index, &ReadNumber](FString& OutText)
+    {
+        const int32 Length = ReadNumber();
+
+        // Stop on a malformed layout instead of reading past the end
+        if (Index >= Layout.Len() || Layout[Index] != TEXT(':') || Index + 1 + Length > Layout.Len())
+        {
+            return false;
+        }
+
+        OutText = Layout.Mid(Index + 1, Length);
+        Index += 1 + Length;
+        return true;
+    };
+
+    // Reads a literal into OutText, returns false for a dynamic field or a malformed layout
+    auto ReadField = [&Layout, &Index, &ReadText](FString& OutText, bool& bOutDynamic)
+    {
+        bOutDynamic = Index < Layout.Len() && Layout[Index] == TEXT('*');
+        if (bOutDynamic)
+        {
+            Index++;
+            return false;
+        }
+        return ReadText(OutText);
+    };
+
+    const int32 Flags = Layout.Len() > 0 && FChar::IsDigit(Layout[0]) ? Layout[Index++] - TEXT('0') : 0;
+    bSeparatorInLayout = (Flags & DebugPrintDescriptor::SeparatorInLayoutFlag) != 0;
+    bPrintOnChange = (Flags & DebugPrintDescriptor::PrintOnChangeFlag) != 0;
+
+    auto ReadOption = [this, &ReadField](EDynamicOption Option, TFunctionRef<void(const FString&)> Parse)
+    {
+        FString Text;
+        bool bDynamic = false;
+        if (ReadField(Text, bDynamic))
+        {
+            Parse(Text);
+        }
+        else if (bDynamic)
+        {
+            DynamicOptions |= Option;
+        }
+    };
+
+    ReadOption(EDynamicOption::Key, [this](const FString& Text) { Key = FName(*Text); });
+    ReadOption(EDynamicOption::Separator, [this](const FString& Text) { Separator = Text; });
+    ReadOption(EDynamicOption::TextColor, [this](const FString& Text) { TextColor.InitFromString(Text); });
+    ReadOption(EDynamicOption::Duration, [this](const FString& Text) { Duration = FCString::Atof(*Text); });
+    ReadOption(EDynamicOption::PrintType, [this](const FString& Text) { PrintType = static_cast<uint8>(FCString::Atoi(*Text)); });
+
+    while (Index < Layout.Len())
+    {
+        FDebugPrintValueLayout Value;
+        if (!ReadText(Value.Label) || !ReadText(Value.LabelPrefix))
+        {
+            break;
+        }
+
+        Value.NumberFormat.Precision = ReadNumber() - 1;
+        if (Index >= Layout.Len() || Layout[Index++] != TEXT(','))
+        {
+            break;
+        }
+        Value.NumberFormat.MinWidth = ReadNumber();
+        if (Index >= Layout.Len() || Layout[Index++] != TEXT(',') || Index >= Layout.Len())
+        {
+            break;
+        }
+
+        bool bDynamic = false;
+        if (!ReadField(Value.Literal.Emplace(), bDynamic))
+        {
+            if (!bDynamic)
+            {
+                break;
+            }
+            Value.Literal.Reset();
+            NumDynamicValues++;
+        }
+
+        Values.Add(MoveTemp(Value));
+    }
+}
@@ -0,0 +1,54 @@
+// Copyright MoxAlehin. All Rights Reserved.
+
+#include "DebugPrintDeveloperSettings.h"
+
+#if WITH_EDITOR
+#include "Misc/CommandLine.h"
+#include "Settings/ProjectPackagingSettings.h"
+#include "DebugPrint.h"
+
+bool UDebugPrintDeveloperSettings::ShouldStripNode(FName NodeCategory) const
+{
+    if (!NodeCategory.IsNone() && KeptCategories.Contains(NodeCategory))
+    {
+        return false;
+    }
+
+    switch (StripPolicy)
+    {
+    case EDebugPrintStripPolicy::Always:
+        return true;
+    case EDebugPrintStripPolicy::Cooked:
+        return IsRunningCookCommandlet();
+    case EDebugPrintStripPolicy::TestAndShipping:
+    {
+        if (!IsRunningCookCommandlet())
+        {
+            return false;
+        }
+
+        // The cook doesn't know which configuration its content is packaged with. Scripted cooks ask for stripping with
+        // -DebugPrintStrip, anything else falls back to the configuration the editor packages with
+        if (FParse::Param(FCommandLine::Get(), TEXT("DebugPrintStrip")))
+        {
+            return true;
+        }
+
+        const EProjectPackagingBuildConfigurations Configuration = GetDefault<UProjectPackagingSettings>()->BuildConfiguration;
+        const bool bStrip = Configuration == EProjectPackagingBuildConfigurations::PPBC_Test ||
+                            Configuration == EProjectPackagingBuildConfigurations::PPBC_Shipping;
+        static bool bLoggedFallback = false;
+        if (!bLoggedFallback)
+        {
+            bLoggedFallback = true;
+            UE_LOG(LogDebugPrint, Display, TEXT("DebugPrint nodes are %s, following the Build Configuration in the packaging settings. ")
+                TEXT("Cooks for Test or Shipping started from the command line or UAT need -DebugPrintStrip ")
+                TEXT("(-AdditionalCookerOptions=-DebugPrintStrip with BuildCookRun)."), bStrip ? TEXT("stripped") : TEXT("kept"));
+        }
+        return bStrip;
+    }
+    default:
+        return false;
+    }
+}
+#endif
@@ -0,0 +1,553 @@
+// Copyright MoxAlehin. All Rights Reserved.
+
+#include "DebugPrintFormatter.h"
+
+#include "Internationalization/TextLocalizationManager.h"
+#include "UObject/TextProperty.h"
+#include "UObject/EnumProperty.h"
+#include "DebugPrintDeveloperSettings.h"
+
+namespace DebugPrintFormatter
+{
+    // Appends the text of a typed value. Containers stop adding elements once the output reaches MaxLength
+    void AppendProperty(FString& Out, const FProperty* Property, const void* Address, const FDebugPrintNumberFormat& Format,
+        int32 MaxLength);
+
+    // Fields of a struct in print order, built once per struct type so formatting is a flat loop over offsets
+    struct FStructFormatPlan
+    {
+        struct FFieldPlan
+        {
+            // Name of the field, already followed by ": "
+            FString Label;
+            const FProperty* Property = nullptr;
+            int32 Offset = 0;
+        };
+
+        TArray<FFieldPlan> Fields;
+
+        // First property of the struct when the plan was built. Recompiled structs get new properties
+        const FField* SourceProperties = nullptr;
+        bool bBuilt = false;
+    };
+
+    // Display names of one enum by value, built again when the enum was edited or the localization changed
+    struct FEnumDisplayNames
+    {
+        TMap<int64, FString> Names;
+        int32 NumEnums = 0;
+        uint16 TextRevision = 0;
+    };
+
+    // Strings of FDebugPrintScratchString, boxed so handing out a new one doesn't move those in use. Game thread only
+    TArray<TUniquePtr<FString>> ScratchStrings;
+    int32 NumScratchStringsInUse = 0;
+
+    // Game thread only, like the rest of the formatter. Plans are boxed so nested structs can add plans while one is in use
+    TMap<const UScriptStruct*, TUniquePtr<FStructFormatPlan>> StructPlans;
+
+    // Game thread only. Looking up the display name text of a value allocates in cooked builds
+    TMap<const UEnum*, FEnumDisplayNames> EnumDisplayNames;
+
+    const FStructFormatPlan& GetStructPlan(const UScriptStruct* Struct)
+    {
+        TUniquePtr<FStructFormatPlan>& PlanPtr = StructPlans.FindOrAdd(Struct);
+        if (!PlanPtr) PlanPtr = MakeUnique<FStructFormatPlan>();
+
+        FStructFormatPlan& Plan = *PlanPtr;
+        if (Plan.bBuilt && Plan.SourceProperties == Struct->ChildProperties)
+        {
+            return Plan;
+        }
+
+        Plan.Fields.Reset();
+        Plan.SourceProperties = Struct->ChildProperties;
+        Plan.bBuilt = true;
+        for (TFieldIterator<FProperty> It(Struct); It; ++It)
+        {
+            // Every element of a fixed size array is its own field
+            const FProperty* Property = *It;
+            const int32 ElementSize = Property->GetSize() / FMath::Max(Property->ArrayDim, 1);
+            for (int32 Index = 0; Index < Property->ArrayDim; ++Index)
+            {
+                FStructFormatPlan::FFieldPlan& Field = Plan.Fields.AddDefaulted_GetRef();
+                Field.Property = Property;
+                Field.Offset = Property->GetOffset_ForInternal() + Index * ElementSize;
+                Field.Label = Property->GetAuthoredName();
+                if (Property->ArrayDim > 1)
+                {
+                    Field.Label += TEXT("[");
+                    Field.Label.AppendInt(Index);
+                    Field.Label += TEXT("]");
+                }
+                Field.Label += TEXT(": ");
+            }
+        }
+        return Plan;
+    }
+
+    // Appends every field of a struct with its name, stopping once the output reaches MaxLength
+    void AppendStructFields(FString& Out, const UScriptStruct* Struct, const void* Address, const FDebugPrintNumberFormat& Format,
+        int32 MaxLength)
+    {
+        const FStructFormatPlan& Plan = GetStructPlan(Struct);
+        const uint8* Data = static_cast<const uint8*>(Address);
+
+        Out += TEXT("(");
+        for (int32 Index = 0; Index < Plan.Fields.Num(); ++Index)
+        {
+            if (Index > 0) Out += TEXT(", ");
+            if (Out.Len() >= MaxLength)
+            {
+                Out += TEXT("...");
+                break;
+            }
+
+            const FStructFormatPlan::FFieldPlan& Field = Plan.Fields[Index];
+            Out += Field.Label;
+            AppendProperty(Out, Field.Property, Data + Field.Offset, Format, MaxLength);
+        }
+        Out += TEXT(")");
+    }
+
+    // Formats into a stack buffer and appends the result in one go, so numbers never allocate on their own
+    template <typename FmtType, typename... ArgTypes>
+    void AppendFormatted(FString& Out, const FmtType& Fmt, ArgTypes... Args)
+    {
+        TCHAR Buffer[512];
+        const int32 Length = FCString::Snprintf(Buffer, UE_ARRAY_COUNT(Buffer), Fmt, Args...);
+        Out.AppendChars(Buffer, FMath::Clamp(Length, 0, int32(UE_ARRAY_COUNT(Buffer)) - 1));
+    }
+
+    void AppendFloat(FString& Out, double Value, const FDebugPrintNumberFormat& Format)
+    {
+        if (Format.Precision >= 0)
+        {
+            AppendFormatted(Out, TEXT("%*.*f"), Format.MinWidth, Format.Precision, Value);
+            return;
+        }
+
+        // Without a precision the text matches SanitizeFloat: trailing zeros are trimmed down to a single decimal
+        TCHAR Buffer[512];
+        int32 Length = FMath::Clamp(FCString::Snprintf(Buffer, UE_ARRAY_COUNT(Buffer), TEXT("%.6f"), Value), 0,
+            int32(UE_ARRAY_COUNT(Buffer)) - 1);
+        while (Length > 2 && Buffer[Length - 1] == TEXT('0') && Buffer[Length - 2] != TEXT('.'))
+        {
+            Length--;
+        }
+
+        for (int32 Padding = Format.MinWidth - Length; Padding > 0; --Padding)
+        {
+            Out.AppendChar(TEXT(' '));
+        }
+        Out.AppendChars(Buffer, Length);
+    }
+
+    // Components of vectors and rotators are formatted in a single call. Without a precision they keep the engine's text
+    void AppendVector(FString& Out, const FVector& Vector, const FDebugPrintNumberFormat& Format)
+    {
+        const int32 Precision = Format.Precision >= 0 ? Format.Precision : 3;
+        const int32 Width = Format.MinWidth;
+        AppendFormatted(Out, TEXT("X=%*.*f Y=%*.*f Z=%*.*f"),
+            Width, Precision, Vector.X, Width, Precision, Vector.Y, Width, Precision, Vector.Z);
+    }
+
+    void AppendVector2D(FString& Out, const FVector2D& Vector, const FDebugPrintNumberFormat& Format)
+    {
+        const int32 Precision = Format.Precision >= 0 ? Format.Precision : 3;
+        const int32 Width = Format.MinWidth;
+        AppendFormatted(Out, TEXT("X=%*.*f Y=%*.*f"), Width, Precision, Vector.X, Width, Precision, Vector.Y);
+    }
+
+    void AppendRotator(FString& Out, const FRotator& Rotator, const FDebugPrintNumberFormat& Format)
+    {
+        const int32 Precision = Format.Precision >= 0 ? Format.Precision : 6;
+        const int32 Width = Format.MinWidth;
+        AppendFormatted(Out, TEXT("P=%*.*f Y=%*.*f R=%*.*f"),
+            Width, Precision, Rotator.Pitch, Width, Precision, Rotator.Yaw, Width, Precision, Rotator.Roll);
+    }
+
+    void AppendEnum(FString& Out, const UEnum* Enum, int64 Value)
+    {
+        FEnumDisplayNames& DisplayNames = EnumDisplayNames.FindOrAdd(Enum);
+        const uint16 TextRevision = FTextLocalizationManager::Get().GetTextRevision();
+        if (DisplayNames.NumEnums != Enum->NumEnums() || DisplayNames.TextRevision != TextRevision)
+        {
+            DisplayNames.Names.Reset();
+            DisplayNames.NumEnums = Enum->NumEnums();
+            DisplayNames.TextRevision = TextRevision;
+        }
+
+        const FString* Name = DisplayNames.Names.Find(Value);
+        if (!Name)
+        {
+            Name = &DisplayNames.Names.Add(Value, Enum->GetDisplayNameTextByValue(Value).ToString());
+        }
+        Out += *Name;
+    }
+
+    void AppendStruct(FString& Out, const FStructProperty* StructProperty, const void* Address, const FDebugPrintNumberFormat& Format,
+        int32 MaxLength)
+    {
+        const UScriptStruct* Struct = StructProperty->Struct;
+
+        if (Struct == TBaseStructure<FVector>::Get())
+        {
+            AppendVector(Out, *static_cast<const FVector*>(Address), Format);
+        }
+        else if (Struct == TBaseStructure<FVector2D>::Get())
+        {
+            AppendVector2D(Out, *static_cast<const FVector2D*>(Address), Format);
+        }
+        else if (Struct == TBaseStructure<FRotator>::Get())
+        {
+            AppendRotator(Out, *static_cast<const FRotator*>(Address), Format);
+        }
+        else if (Struct == TBaseStructure<FLinearColor>::Get())
+        {
+            // Same text as FLinearColor::ToString, without the temporary string
+            const FLinearColor& Color = *static_cast<const FLinearColor*>(Address);
+            AppendFormatted(Out, TEXT("(R=%f,G=%f,B=%f,A=%f)"), Color.R, Color.G, Color.B, Color.A);
+        }
+        else if (Struct == TBaseStructure<FColor>::Get())
+        {
+            const FColor& Color = *static_cast<const FColor*>(Address);
+            AppendFormatted(Out, TEXT("(R=%i,G=%i,B=%i,A=%i)"), Color.R, Color.G, Color.B, Color.A);
+        }
+        else if (Struct == TBaseStructure<FTransform>::Get())
+        {
+            const FTransform* Transform = static_cast<const FTransform*>(Address);
+            Out += TEXT("Translation: ");
+            AppendVector(Out, Transform->GetTranslation(), Format);
+            Out += TEXT(" Rotation: ");
+            AppendRotator(Out, Transform->Rotator(), Format);
+            Out += TEXT(" Scale ");
+            AppendVector(Out, Transform->GetScale3D(), Format);
+        }
+        else if (Struct->StructFlags & STRUCT_ExportTextItemNative)
+        {
+            // Structs with their own text export know best how to show themselves
+            StructProperty->ExportTextItem_Direct(Out, Address, nullptr, nullptr, PPF_None);
+        }
+        else
+        {
+            AppendStructFields(Out, Struct, Address, Format, MaxLength);
+        }
+    }
+
+    // Appends the elements of an array, set or map straight to the output. Only the shown elements are visited,
+    // the others are summarized by their count. The output is not extended past MaxLength
+    void AppendContainer(FString& Out, const FProperty* Property, const void* Address, const FDebugPrintNumberFormat& Format,
+        int32 MaxLength)
+    {
+        const UDebugPrintDeveloperSettings* Settings = GetDefault<UDebugPrintDeveloperSettings>();
+        const int32 MaxElements = FMath::Max(Settings->MaxContainerElements, 1);
+        MaxLength = FMath::Min(MaxLength, Out.Len() + FMath::Max(Settings->MaxContainerLength, 1));
+
+        const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property);
+        const FSetProperty* SetProperty = CastField<FSetProperty>(Property);
+        const FMapProperty* MapProperty = CastField<FMapProperty>(Property);
+
+        const int32 MaxElementLength = FMath::Max(Settings->MaxContainerElementLength, 1);
+
+        // Sets and maps are sparse: their pages are ranges of sparse indices, so no page walks the ones before it
+        TOptional<FScriptArrayHelper> ArrayHelper;
+        TOptional<FScriptSetHelper> SetHelper;
+        TOptional<FScriptMapHelper> MapHelper;
+        int32 Num = 0;
+        int32 MaxIndex = 0;
+        if (ArrayProperty)
+        {
+            ArrayHelper.Emplace(ArrayProperty, Address);
+            Num = MaxIndex = ArrayHelper->Num();
+        }
+        else if (SetProperty)
+        {
+            SetHelper.Emplace(SetProperty, Address);
+            Num = SetHelper->Num();
+            MaxIndex = SetHelper->GetMaxIndex();
+        }
+        else
+        {
+            MapHelper.Emplace(MapProperty, Address);
+            Num = MapHelper->Num();
+            MaxIndex = MapHelper->GetMaxIndex();
+        }
+
+        // Containers with more elements than fit show one page after another
+        int32 FirstIndex = 0;
+        int32 EndIndex = MaxIndex;
+        if (Settings->ContainerPageInterval > 0.f && Num > MaxElements)
+        {
+            const int32 NumPages = FMath::DivideAndRoundUp(MaxIndex, MaxElements);
+            const int32 Page = static_cast<int32>(static_cast<int64>(FPlatformTime::Seconds() / Settings->ContainerPageInterval) % NumPages);
+            FirstIndex = Page * MaxElements;
+            EndIndex = FMath::Min(FirstIndex + MaxElements, MaxIndex);
+            if (ArrayProperty)
+            {
+                AppendFormatted(Out, TEXT("%d-%d of %d "), FirstIndex, EndIndex - 1, Num);
+            }
+            else
+            {
+                AppendFormatted(Out, TEXT("page %d/%d of %d "), Page + 1, NumPages, Num);
+            }
+        }
+
+        Out += ArrayProperty ? TEXT("[") : TEXT("{");
+
+        // Each element is formatted on its own and cut off, so one long string can't fill the whole container
+        FDebugPrintScratchString ElementText;
+        int32 NumShown = 0;
+        for (int32 Index = FirstIndex; Index < EndIndex && NumShown < MaxElements && Out.Len() < MaxLength; ++Index)
+        {
+            if (SetHelper && !SetHelper->IsValidIndex(Index)) continue;
+            if (MapHelper && !MapHelper->IsValidIndex(Index)) continue;
+
+            ElementText->Reset();
+            if (ArrayHelper)
+            {
+                AppendProperty(*ElementText, ArrayProperty->Inner, ArrayHelper->GetRawPtr(Index), Format, MaxElementLength);
+            }
+            else if (SetHelper)
+            {
+                AppendProperty(*ElementText, SetProperty->ElementProp, SetHelper->GetElementPtr(Index), Format, MaxElementLength);
+            }
+            else
+            {
+                AppendProperty(*ElementText, MapProperty->KeyProp, MapHelper->GetKeyPtr(Index), Format, MaxElementLength);
+                *ElementText += TEXT(": ");
+                AppendProperty(*ElementText, MapProperty->ValueProp, MapHelper->GetValuePtr(Index), Format, MaxElementLength);
+            }
+
+            if (NumShown++ > 0) Out += TEXT(", ");
+            Out.AppendChars(**ElementText, FMath::Min(ElementText->Len(), MaxElementLength));
+            if (ElementText->Len() > MaxElementLength) Out += TEXT("...");
+        }
+
+        const int32 NumHidden = Num - NumShown;
+        if (NumHidden > 0)
+        {
+            if (NumShown > 0) Out += TEXT(", ");
+            AppendFormatted(Out, TEXT("... (+%d more)"), NumHidden);
+        }
+        Out += ArrayProperty ? TEXT("]") : TEXT("}");
+    }
+}
+
+void FDebugPrintFormatter::AppendValue(FString& Out, const FDebugPrintValue& Value)
+{
+    if (Value.Literal)
+    {
+        Out += *Value.Literal;
+        return;
+    }
+
+    if (Value.Property && Value.Address)
+    {
+        DebugPrintFormatter::AppendProperty(Out, Value.Property, Value.Address,
+            Value.NumberFormat ? *Value.NumberFormat : FDebugPrintNumberFormat(), MAX_int32);
+    }
+}
+
+void DebugPrintFormatter::AppendProperty(FString& Out, const FProperty* Property, const void* Address,
+    const FDebugPrintNumberFormat& Format, int32 MaxLength)
+{
+    if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+    {
+        Out += BoolProperty->GetPropertyValue(Address) ? TEXT("true") : TEXT("false");
+    }
+    else if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+    {
+        AppendEnum(Out, EnumProperty->GetEnum(), EnumProperty->GetUnderlyingProperty()->GetSignedIntPropertyValue(Address));
+    }
+    else if (const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property))
+    {
+        if (const UEnum* Enum = NumericProperty->GetIntPropertyEnum())
+        {
+            AppendEnum(Out, Enum, NumericProperty->GetSignedIntPropertyValue(Address));
+        }
+        else if (NumericProperty->IsFloatingPoint())
+        {
+            AppendFloat(Out, NumericProperty->GetFloatingPointPropertyValue(Address), Format);
+        }
+        else if (Property->IsA<FUInt64Property>())
+        {
+            const uint64 Value = NumericProperty->GetUnsignedIntPropertyValue(Address);
+            AppendFormatted(Out, TEXT("%*llu"), Format.MinWidth, static_cast<unsigned long long>(Value));
+        }
+        else
+        {
+            const int64 Value = NumericProperty->GetSignedIntPropertyValue(Address);
+            AppendFormatted(Out, TEXT("%*lld"), Format.MinWidth, static_cast<long long>(Value));
+        }
+    }
+    else if (const FStrProperty* StrProperty = CastField<FStrProperty>(Property))
+    {
+        Out += StrProperty->GetPropertyValue(Address);
+    }
+    else if (const FNameProperty* NameProperty = CastField<FNameProperty>(Property))
+    {
+        NameProperty->GetPropertyValue(Address).AppendString(Out);
+    }
+    else if (const FTextProperty* TextProperty = CastField<FTextProperty>(Property))
+    {
+        Out += TextProperty->GetPropertyValue(Address).ToString();
+    }
+    else if (const FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(Property))
+    {
+        const UObject* Object = ObjectProperty->GetObjectPropertyValue(Address);
+        if (Object)
+        {
+            Object->GetFName().AppendString(Out);
+        }
+        else
+        {
+            Out += TEXT("None");
+        }
+    }
+    else if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+    {
+        AppendStruct(Out, StructProperty, Address, Format, MaxLength);
+    }
+    else if (Property->IsA<FArrayProperty>() || Property->IsA<FSetProperty>() || Property->IsA<FMapProperty>())
+    {
+        AppendContainer(Out, Property, Address, Format, MaxLength);
+    }
+    else
+    {
+        Property->ExportTextItem_Direct(Out, Address, nullptr, nullptr, PPF_None);
+    }
+}
+
+uint32 FDebugPrintFormatter::HashValue(const FDebugPrintValue& Value)
+{
+    // Literals never change while the node is loaded
+    if (Value.Literal)
+    {
+        return PointerHash(Value.Literal);
+    }
+
+    const FProperty* Property = Value.Property;
+    if (!Property || !Value.Address)
+    {
+        return 0;
+    }
+
+    // The engine hashes strings and names ignoring case, which would miss a value that only changed its case
+    if (const FStrProperty* StrProperty = CastField<FStrProperty>(Property))
+    {
+        return FCrc::StrCrc32(*StrProperty->GetPropertyValue(Value.Address));
+    }
+    if (const FNameProperty* NameProperty = CastField<FNameProperty>(Property))
+    {
+        const FName Name = NameProperty->GetPropertyValue(Value.Address);
+        return HashCombineFast(GetTypeHash(Name.GetDisplayIndex()), uint32(Name.GetNumber()));
+    }
+    if (const FTextProperty* TextProperty = CastField<FTextProperty>(Property))
+    {
+        return FCrc::StrCrc32(*TextProperty->GetPropertyValue(Value.Address).ToString());
+    }
+
+    if (Property->HasAllPropertyFlags(CPF_HasGetValueTypeHash))
+    {
+        return Property->GetValueTypeHash(Value.Address);
+    }
+    if (Property->HasAllPropertyFlags(CPF_IsPlainOldData))
+    {
+        return FCrc::MemCrc32(Value.Address, Property->GetSize());
+    }
+
+    FDebugPrintScratchString Text;
+    AppendValue(*Text, Value);
+    return FCrc::StrCrc32(**Text);
+}
+
+bool FDebugPrintFormatter::GetNumber(const FDebugPrintValue& Value, double& OutNumber)
+{
+    if (Value.Literal)
+    {
+        if (Value.Literal->IsNumeric())
+        {
+            OutNumber = FCString::Atod(**Value.Literal);
+            return true;
+        }
+        if (Value.Literal->Equals(TEXT("true")) || Value.Literal->Equals(TEXT("false")))
+        {
+            OutNumber = Value.Literal->Equals(TEXT("true")) ? 1.0 : 0.0;
+            return true;
+        }
+        return false;
+    }
+
+    if (!Value.Property || !Value.Address)
+    {
+        return false;
+    }
+
+    if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Value.Property))
+    {
+        OutNumber = BoolProperty->GetPropertyValue(Value.Address) ? 1.0 : 0.0;
+        return true;
+    }
+
+    // Enums are shown by name, so they are not graphed
+    const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Value.Property);
+    if (!NumericProperty || NumericProperty->GetIntPropertyEnum())
+    {
+        return false;
+    }
+
+    OutNumber = NumericProperty->IsFloatingPoint()
+        ? NumericProperty->GetFloatingPointPropertyValue(Value.Address)
+        : double(NumericProperty->GetSignedIntPropertyValue(Value.Address));
+    return true;
+}
+
+bool FDebugPrintFormatter::IsFormattedNatively(const UScriptStruct* Struct)
+{
+    return Struct == TBaseStructure<FVector>::Get() || Struct == TBaseStructure<FVector2D>::Get() ||
+           Struct == TBaseStructure<FRotator>::Get() || Struct == TBaseStructure<FLinearColor>::Get() ||
+           Struct == TBaseStructure<FColor>::Get() || Struct == TBaseStructure<FTransform>::Get();
+}
+
+void FDebugPrintFormatter::AppendDouble(FString& Out, double Value, const FDebugPrintNumberFormat& Format)
+{
+    DebugPrintFormatter::AppendFloat(Out, Value, Format);
+}
+
+void FDebugPrintFormatter::AppendInteger(FString& Out, int64 Value, const FDebugPrintNumberFormat& Format)
+{
+    DebugPrintFormatter::AppendFormatted(Out, TEXT("%*lld"), Format.MinWidth, static_cast<long long>(Value));
+}
+
+void FDebugPrintFormatter::AppendVector(FString& Out, const FVector& Value, const FDebugPrintNumberFormat& Format)
+{
+    DebugPrintFormatter::AppendVector(Out, Value, Format);
+}
+
+void FDebugPrintFormatter::AppendRotator(FString& Out, const FRotator& Value, const FDebugPrintNumberFormat& Format)
+{
+    DebugPrintFormatter::AppendRotator(Out, Value, Format);
+}
+
+FDebugPrintScratchString::FDebugPrintScratchString()
+    : String([]() -> FString&
+    {
+        using namespace DebugPrintFormatter;
+        check(IsInGameThread());
+        if (NumScratchStringsInUse == ScratchStrings.Num())
+        {
+            ScratchStrings.Add(MakeUnique<FString>());
+        }
+        FString& Scratch = *ScratchStrings[NumScratchStringsInUse++];
+        Scratch.Reset();
+        return Scratch;
+    }())
+{
+}
+
+FDebugPrintScratchString::~FDebugPrintScratchString()
+{
+    // Scratch strings are scoped, so the one given back is always the last one handed out
+    DebugPrintFormatter::NumScratchStringsInUse--;
+}
@@ -0,0 +1,457 @@
+// Copyright MoxAlehin. All Rights Reserved.
+
+#include "DebugPrintLibrary.h"
+
+#include "Engine/Engine.h"
+#include "Misc/MemStack.h"
+#include "Misc/ScopeExit.h"
+#include "UObject/Script.h"
+#include "DebugPrintCategories.h"
+#include "DebugPrintDescriptor.h"
+#include "DebugPrintDeveloperSettings.h"
+#include "DebugPrintRecorder.h"
+#include "DebugPrintRenderer.h"
+#include "DebugPrintStats.h"
+#include "DebugPrintTrace.h"
+#include "DebugPrintWatch.h"
+#include "UObject/ObjectKey.h"
+
+namespace DebugPrintLibrary
+{
+    // Arrays of a single print call. Nodes with more values than fit inline spill to the thread's linear
+    // FMemStack arena instead of the heap, and the arena is rewound when the call returns
+    template <typename T>
+    using TCallArray = TArray<T, TInlineAllocator<16, TMemStackAllocator<>>>;
+
+    struct FThrottleState
+    {
+        double LastPrintTime = -DBL_MAX;
+        int32 Executions = 0;
+    };
+
+    // Throttle state of every node and object pair. Game thread only, like the Blueprints calling it
+    TMap<TPair<FGuid, FObjectKey>, FThrottleState> ThrottleStates;
+
+    // Hash of the values each node and object printed last as an unkeyed line
+    TMap<TPair<FName, FObjectKey>, uint32> LastInlineHashes;
+
+    // Samples of a value printed as a graph and aggregates of one printed with statistics. Kept here with the other
+    // per-node state rather than in the line on screen, so an expired entry or a reused key doesn't restart them
+    struct FAggregateState
+    {
+        TSharedPtr<FDebugPrintHistory> History;
+        FDebugPrintStatistics Statistics;
+
+        // Label of the value, copied once for DebugPrint.Stats.Snapshot
+        FString Label;
+    };
+
+    // Aggregates of every node, label and object. The label is stored as its hash, so looking one up doesn't allocate
+    TMap<TPair<TPair<FGuid, uint32>, FObjectKey>, FAggregateState> AggregateStates;
+
+    // Entries of destroyed objects are dropped once a map grows past its threshold. The threshold then doubles the
+    // surviving count, so a map full of live objects isn't walked again on every call
+    constexpr int32 ThrottleStatesPruneThreshold = 4096;
+    constexpr int32 InlineHashesPruneThreshold = 1024;
+    constexpr int32 AggregateStatesPruneThreshold = 1024;
+    int32 ThrottleStatesPruneAt = ThrottleStatesPruneThreshold;
+    int32 InlineHashesPruneAt = InlineHashesPruneThreshold;
+    int32 AggregateStatesPruneAt = AggregateStatesPruneThreshold;
+
+    template <typename KeyType, typename ValueType>
+    void PruneDestroyedObjects(TMap<TPair<KeyType, FObjectKey>, ValueType>& Map, int32& PruneAt, int32 Threshold)
+    {
+        if (Map.Num() < PruneAt)
+        {
+            return;
+        }
+
+        for (auto It = Map.CreateIterator(); It; ++It)
+        {
+            if (!It.Key().Value.ResolveObjectPtr()) It.RemoveCurrent();
+        }
+        PruneAt = FMath::Max(Threshold, Map.Num() * 2);
+    }
+
+    FAggregateState& FindOrAddAggregateState(const UObject* WorldContextObject, const FDebugPrintNodeDescriptor& Descriptor,
+        const FDebugPrintValueLayout* Layout, int32 ValueIndex)
+    {
+        PruneDestroyedObjects(AggregateStates, AggregateStatesPruneAt, AggregateStatesPruneThreshold);
+        const uint32 LabelHash = Layout ? FCrc::StrCrc32(*Layout->Label) : uint32(ValueIndex);
+        FAggregateState& State = AggregateStates.FindOrAdd(TPair<TPair<FGuid, uint32>, FObjectKey>(
+            TPair<FGuid, uint32>(Descriptor.NodeGuid, LabelHash), FObjectKey(WorldContextObject)));
+        if (Layout && State.Label.IsEmpty()) State.Label = Layout->Label;
+        return State;
+    }
+
+    // Steps over a string literal in the bytecode without reading it. Returns false when the next argument isn't one
+    bool SkipStringConst(FFrame& Stack)
+    {
+        if (!Stack.Code)
+        {
+            return false;
+        }
+
+        const uint8* Code = Stack.Code + 1;
+        if (*Stack.Code == EX_StringConst)
+        {
+            while (*Code != 0) Code++;
+            Stack.Code = Code + 1;
+            return true;
+        }
+        if (*Stack.Code == EX_UnicodeStringConst)
+        {
+            while (Code[0] != 0 || Code[1] != 0) Code += 2;
+            Stack.Code = Code + 2;
+            return true;
+        }
+        return false;
+    }
+}
+
+DEFINE_FUNCTION(UDebugPrintLibrary::execDebugPrint)
+{
+    DEBUGPRINT_SCOPE_CYCLE_COUNTER(STAT_DebugPrint_Call);
+    FMemMark Mark(FMemStack::Get());
+
+    P_GET_OBJECT(UObject, WorldContextObject);
+    P_GET_STRUCT(FGuid, NodeGuid);
+    P_GET_PROPERTY(FIntProperty, LayoutHash);
+
+    // Once the node is decoded, its layout literal is stepped over instead of being copied into a string
+    const uint8* LayoutCode = Stack.Code;
+    const FDebugPrintNodeDescriptor* Descriptor = FDebugPrintNodeDescriptor::Find(NodeGuid, LayoutHash, LayoutCode);
+    if (!Descriptor || !DebugPrintLibrary::SkipStringConst(Stack))
+    {
+        P_GET_PROPERTY(FStrProperty, Layout);
+        Descriptor = &FDebugPrintNodeDescriptor::Get(NodeGuid, Layout, LayoutHash, LayoutCode);
+    }
+
+    // Linked options come first, everything else was baked into the descriptor
+    using EDynamicOption = FDebugPrintNodeDescriptor::EDynamicOption;
+    FName Key = Descriptor->Key;
+    if (Descriptor->IsDynamic(EDynamicOption::Key))
+    {
+        Stack.StepCompiledIn<FNameProperty>(&Key);
+    }
+
+    // A linked separator is read by reference, so a variable isn't copied
+    FString DynamicSeparator;
+    const FString* Separator = &Descriptor->Separator;
+    if (Descriptor->IsDynamic(EDynamicOption::Separator))
+    {
+        Separator = &Stack.StepCompiledInRef<FStrProperty, FString>(&DynamicSeparator);
+    }
+
+    FLinearColor TextColor = Descriptor->TextColor;
+    if (Descriptor->IsDynamic(EDynamicOption::TextColor))
+    {
+        Stack.StepCompiledIn<FStructProperty>(&TextColor);
+    }
+
+    float Duration = Descriptor->Duration;
+    if (Descriptor->IsDynamic(EDynamicOption::Duration))
+    {
+        double DynamicDuration = Duration;
+        Stack.StepCompiledIn<FDoubleProperty>(&DynamicDuration);
+        Duration = static_cast<float>(DynamicDuration);
+    }
+
+    uint8 Type = Descriptor->PrintType;
+    if (Descriptor->IsDynamic(EDynamicOption::PrintType))
+    {
+        Stack.StepCompiledIn<FByteProperty>(&Type);
+    }
+
+    // Capture every value as a property and an address instead of converting it to a string
+    DebugPrintLibrary::TCallArray<FDebugPrintValue> Values;
+    Values.Reserve(Descriptor->Values.Num());
+    for (const FDebugPrintValueLayout& ValueLayout : Descriptor->Values)
+    {
+        FDebugPrintValue& Value = Values.AddDefaulted_GetRef();
+        Value.NumberFormat = &ValueLayout.NumberFormat;
+        if (ValueLayout.Literal.IsSet())
+        {
+            Value.Literal = &ValueLayout.Literal.GetValue();
+            continue;
+        }
+
+        // The node routes every linked value through a variable, so stepping without a result only records its
+        // address and nothing is copied
+        Stack.MostRecentProperty = nullptr;
+        Stack.MostRecentPropertyAddress = nullptr;
+        Stack.StepCompiledIn<FProperty>(nullptr);
+
+        if (Stack.MostRecentPropertyAddress)
+        {
+            Value.Property = Stack.MostRecentProperty;
+            Value.Address = Stack.MostRecentPropertyAddress;
+        }
+    }
+
+    P_FINISH;
+
+    P_NATIVE_BEGIN;
+#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+    FDebugPrintRecorder& Recorder = FDebugPrintRecorder::Get();
+    if (Recorder.IsRecording())
+    {
+        Recorder.Record(NodeGuid, *Descriptor, Values);
+    }
+    if (DebugPrintTrace::IsEnabled())
+    {
+        DebugPrintTrace::TraceValues(NodeGuid, *Descriptor, Values);
+    }
+#endif
+    PrintValues(WorldContextObject, Values, *Descriptor, Key, *Separator, Descriptor->bSeparatorInLayout, TextColor, Duration,
+        EPrintType(Type));
+    P_NATIVE_END;
+}
+
+bool UDebugPrintLibrary::IsCategoryEnabled(FName Category)
+{
+    return FDebugPrintCategories::Get().IsEnabled(Category);
+}
+
+bool UDebugPrintLibrary::ShouldPrint(const UObject* WorldContextObject, const FGuid& NodeGuid, float MaxUpdateRate,
+    int32 PrintEveryNth, float SampleChance)
+{
+    using namespace DebugPrintLibrary;
+
+    if (SampleChance < 1.f && FMath::FRand() >= SampleChance)
+    {
+        return false;
+    }
+
+    PruneDestroyedObjects(ThrottleStates, ThrottleStatesPruneAt, ThrottleStatesPruneThreshold);
+
+    FThrottleState& State = ThrottleStates.FindOrAdd(TPair<FGuid, FObjectKey>(NodeGuid, FObjectKey(WorldContextObject)));
+
+    if (PrintEveryNth > 1)
+    {
+        // The counter wraps at N, so it can't overflow on objects that live for a long time
+        const bool bPrintThisExecution = State.Executions == 0;
+        if (++State.Executions >= PrintEveryNth) State.Executions = 0;
+        if (!bPrintThisExecution)
+        {
+            return false;
+        }
+    }
+
+    if (MaxUpdateRate > 0.f)
+    {
+        const double Now = FPlatformTime::Seconds();
+        if (Now - State.LastPrintTime < 1.0 / MaxUpdateRate)
+        {
+            return false;
+        }
+        State.LastPrintTime = Now;
+    }
+
+    return true;
+}
+
+void UDebugPrintLibrary::PrintValues(const UObject* WorldContextObject, TConstArrayView<FDebugPrintValue> Values,
+    const FDebugPrintNodeDescriptor& Descriptor, FName Key, const FString& Separator, bool bSeparatorInLayout,
+    FLinearColor TextColor, float Duration, EPrintType Type)
+{
+#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+    // Nothing will be shown, so don't convert the values to text
+    if (!GEngine || (!GAreScreenMessagesEnabled && !FDebugPrintWatch::Get().IsWatched()))
+    {
+        return;
+    }
+
+    FMemMark Mark(FMemStack::Get());
+
+    // Graphs and statistics take a sample on every call, even when the value didn't change
+    const bool bAggregates = Type == EPrintType::PrintGraph || Type == EPrintType::PrintStatistics;
+
+    // A node printing on change hashes its values first and only formats the ones that changed
+    DebugPrintLibrary::TCallArray<uint32> ValueHashes;
+    uint32 ContentHash = 0;
+    if (Descriptor.bPrintOnChange)
+    {
+        // The node and its layout are part of every hash, so a new print type, separator, label or number format
+        // formats everything again
+        uint32 LayoutHash = HashCombineFast(GetTypeHash(Descriptor.NodeGuid), uint32(Descriptor.SourceLayoutHash));
+        LayoutHash = HashCombineFast(LayoutHash, HashCombineFast(uint32(Type), FCrc::StrCrc32(*Separator)));
+        LayoutHash = HashCombineFast(LayoutHash, uint32(bSeparatorInLayout));
+        ContentHash = LayoutHash;
+        for (const FDebugPrintValue& Value : Values)
+        {
+            ValueHashes.Add(HashCombineFast(LayoutHash, FDebugPrintFormatter::HashValue(Value)));
+            ContentHash = HashCombineFast(ContentHash, ValueHashes.Last());
+        }
+    }
+
+    // Inline output without a key stacks up like Print String, everything else replaces the entry of the node
+    const FName EntryKey = Key.IsNone() && Type != EPrintType::PrintInline ? Descriptor.GuidKey : Key;
+
+    if (Descriptor.bPrintOnChange)
+    {
+        if (EntryKey.IsNone())
+        {
+            // Unkeyed lines can't be refreshed, so a line is only added when the values of this object changed
+            using namespace DebugPrintLibrary;
+            PruneDestroyedObjects(LastInlineHashes, InlineHashesPruneAt, InlineHashesPruneThreshold);
+
+            uint32& LastHash = LastInlineHashes.FindOrAdd(TPair<FName, FObjectKey>(Descriptor.GuidKey, FObjectKey(WorldContextObject)));
+            if (LastHash == ContentHash)
+            {
+                return;
+            }
+            LastHash = ContentHash;
+        }
+        else if (FDebugPrintEntry* ShownEntry = !bAggregates ? FDebugPrintRenderer::Get().FindEntry(EntryKey) : nullptr)
+        {
+            // Nothing changed, so only keep the entry on screen a little longer
+            if (ShownEntry->ContentHash == ContentHash && ShownEntry->Cells.Num() > 0)
+            {
+                ShownEntry->Color = TextColor;
+                ShownEntry->ExpireTime = FPlatformTime::Seconds() + Duration;
+                return;
+            }
+        }
+    }
+
+    FDebugPrintEntry* SubmittedEntry = nullptr;
+    {
+        DEBUGPRINT_SCOPE_CYCLE_COUNTER(STAT_DebugPrint_Submit);
+        SubmittedEntry = &FDebugPrintRenderer::Get().AddEntry(EntryKey, WorldContextObject, TextColor, Duration);
+    }
+
+    DEBUGPRINT_SCOPE_CYCLE_COUNTER(STAT_DebugPrint_Format);
+    FDebugPrintEntry& Entry = *SubmittedEntry;
+    Entry.NodeGuid = Descriptor.NodeGuid;
+    Entry.bAlignColumns = Type == EPrintType::PrintInColumns || Type == EPrintType::PrintGraph || Type == EPrintType::PrintStatistics;
+    Entry.ContentHash = ContentHash;
+
+    // Counts the text formatted by this call once it returns
+    int32 NumFormattedChars = 0;
+    ON_SCOPE_EXIT
+    {
+        DebugPrintStats::CountMessage(Values.Num(), NumFormattedChars * sizeof(TCHAR));
+    };
+
+    // If the type is inline or replace, print all values on the same line
+    if (Type == EPrintType::PrintInline || Type == EPrintType::PrintReplace)
+    {
+        Entry.Cells.SetNum(1);
+        FDebugPrintCell& Cell = Entry.Cells[0];
+        Cell.Label.Reset();
+        Cell.Value.Reset();
+        Cell.History.Reset();
+        Cell.ValueHash = ContentHash;
+        for (int32 i = 0; i < Values.Num(); i++)
+        {
+            if (i > 0) Cell.Value += Separator;
+            FDebugPrintFormatter::AppendValue(Cell.Value, Values[i]);
+        }
+        NumFormattedChars = Cell.Value.Len();
+        return;
+    }
+
+    // Print each value on its own line. Strings are refilled in place, so their memory is reused every frame
+    const UDebugPrintDeveloperSettings* Settings = GetDefault<UDebugPrintDeveloperSettings>();
+    Entry.Cells.SetNum(Values.Num());
+    for (int32 i = 0; i < Values.Num(); i++)
+    {
+        FDebugPrintCell& Cell = Entry.Cells[i];
+
+        // Unchanged lines keep their text. Graphs and statistics still need a sample every time
+        const uint32 ValueHash = ValueHashes.IsValidIndex(i) ? ValueHashes[i] : 0;
+        if (ValueHash != 0 && Cell.ValueHash == ValueHash && !bAggregates)
+        {
+            continue;
+        }
+        Cell.ValueHash = ValueHash;
+        Cell.Value.Reset();
+
+        // Numbers are graphed or aggregated, anything else is shown as in columns
+        const FDebugPrintValueLayout* Layout = Descriptor.Values.IsValidIndex(i) ? &Descriptor.Values[i] : nullptr;
+        double Number = 0.0;
+        const bool bNumber = bAggregates && FDebugPrintFormatter::GetNumber(Values[i], Number);
+        const FDebugPrintStatistics* Statistics = nullptr;
+        if (bNumber && Type == EPrintType::PrintGraph)
+        {
+            using namespace DebugPrintLibrary;
+            TSharedPtr<FDebugPrintHistory>& History = FindOrAddAggregateState(WorldContextObject, Descriptor, Layout, i).History;
+            if (!History.IsValid()) History = MakeShared<FDebugPrintHistory>();
+            History->SetCapacity(Settings->GraphHistorySize);
+            History->Add(static_cast<float>(Number));
+            Cell.History = History;
+        }
+        else
+        {
+            Cell.History.Reset();
+        }
+
+        if (bNumber && Type == EPrintType::PrintStatistics)
+        {
+            using namespace DebugPrintLibrary;
+            FDebugPrintStatistics& NodeStatistics = FindOrAddAggregateState(WorldContextObject, Descriptor, Layout, i).Statistics;
+            NodeStatistics.SetWindowSize(Settings->StatisticsWindowSize);
+            NodeStatistics.Add(Number);
+            Statistics = &NodeStatistics;
+        }
+
+        if (bNumber)
+        {
+            // The graph separates the label from the value, statistics are shown instead of the value
+            if (Layout && !Cell.Label.Equals(Layout->Label, ESearchCase::CaseSensitive)) Cell.Label = Layout->Label;
+            if (Type == EPrintType::PrintGraph)
+            {
+                FDebugPrintFormatter::AppendValue(Cell.Value, Values[i]);
+                Cell.Value.Appendf(TEXT("  [%g .. %g]"), Cell.History->GetMin(), Cell.History->GetMax());
+            }
+            else
+            {
+                Cell.Value += Separator;
+                Statistics->AppendSummary(Cell.Value);
+            }
+            NumFormattedChars += Cell.Value.Len();
+            continue;
+        }
+
+        if (Layout && (Type == EPrintType::PrintInColumns || bAggregates))
+        {
+            // The label is drawn in its own column, the separator starts the value column
+            if (!Cell.Label.Equals(Layout->Label, ESearchCase::CaseSensitive)) Cell.Label = Layout->Label;
+            Cell.Value += Separator;
+        }
+        else
+        {
+            Cell.Label.Reset();
+            if (Layout && Type == EPrintType::PrintLabels)
+            {
+                Cell.Value += Layout->LabelPrefix;
+                if (!bSeparatorInLayout) Cell.Value += Separator;
+            }
+        }
+
+        FDebugPrintFormatter::AppendValue(Cell.Value, Values[i]);
+        NumFormattedChars += Cell.Value.Len();
+    }
+#endif
+}
+
+void UDebugPrintLibrary::ResetStatistics()
+{
+    for (TPair<TPair<TPair<FGuid, uint32>, FObjectKey>, DebugPrintLibrary::FAggregateState>& Pair : DebugPrintLibrary::AggregateStates)
+    {
+        Pair.Value.Statistics.Reset();
+    }
+}
+
+void UDebugPrintLibrary::ForEachStatistics(
+    TFunctionRef<void(const FGuid& NodeGuid, const UObject* Object, const FString& Label, const FDebugPrintStatistics& Statistics)> Callback)
+{
+    for (const TPair<TPair<TPair<FGuid, uint32>, FObjectKey>, DebugPrintLibrary::FAggregateState>& Pair : DebugPrintLibrary::AggregateStates)
+    {
+        if (!Pair.Value.Statistics.IsEmpty())
+        {
+            Callback(Pair.Key.Key.Key, Pair.Key.Value.ResolveObjectPtr(), Pair.Value.Label, Pair.Value.Statistics);
+        }
+    }
+}
@@ -0,0 +1,173 @@
+// Copyright MoxAlehin. All Rights Reserved.
+
+#include "DebugPrintQueue.h"
+
+#include "DebugPrint.h"
+#include "DebugPrintCategories.h"
+#include "DebugPrintDeveloperSettings.h"
+#include "DebugPrintRenderer.h"
+#include "DebugPrintStats.h"
+
+namespace DebugPrintQueue
+{
+    int32 CopyText(TCHAR* Dest, int32 MaxLength, FStringView Text)
+    {
+        const int32 Length = FMath::Min(Text.Len(), MaxLength);
+        FMemory::Memcpy(Dest, Text.GetData(), Length * sizeof(TCHAR));
+        return Length;
+    }
+}
+
+FDebugPrintQueue& FDebugPrintQueue::Get()
+{
+    static FDebugPrintQueue Queue;
+    return Queue;
+}
+
+void FDebugPrintQueue::Initialize()
+{
+    if (Slots.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    const uint32 Capacity = FMath::RoundUpToPowerOfTwo(
+        FMath::Max(GetDefault<UDebugPrintDeveloperSettings>()->ThreadQueueSize, 16));
+
+    FSlot* NewSlots = new FSlot[Capacity];
+    for (uint32 Index = 0; Index < Capacity; ++Index)
+    {
+        NewSlots[Index].Sequence.store(Index, std::memory_order_relaxed);
+    }
+
+    Mask = Capacity - 1;
+    EnqueuePosition.store(0, std::memory_order_relaxed);
+    DequeuePosition = 0;
+    Slots.store(NewSlots, std::memory_order_release);
+
+    TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FDebugPrintQueue::Tick));
+}
+
+void FDebugPrintQueue::Shutdown()
+{
+    if (TickHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+        TickHandle.Reset();
+    }
+
+    // Worker threads are expected to be done printing by the time the module unloads
+    delete[] Slots.exchange(nullptr, std::memory_order_acq_rel);
+}
+
+bool FDebugPrintQueue::Enqueue(FName Key, FStringView Label, FStringView Value, FLinearColor Color, float Duration)
+{
+    FSlot* const Ring = Slots.load(std::memory_order_acquire);
+    if (!Ring || !FDebugPrintCategories::Get().IsPrintingEnabled())
+    {
+        return false;
+    }
+
+    // Claim the next free slot. A slot still holding an unread message means the queue is full
+    uint64 Position = EnqueuePosition.load(std::memory_order_relaxed);
+    FSlot* Slot = nullptr;
+    for (;;)
+    {
+        Slot = &Ring[Position & Mask];
+        const int64 Difference = int64(Slot->Sequence.load(std::memory_order_acquire)) - int64(Position);
+        if (Difference == 0)
+        {
+            if (EnqueuePosition.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (Difference < 0)
+        {
+            NumDropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        else
+        {
+            Position = EnqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    FDebugPrintMessage& Message = Slot->Message;
+    Message.Key = Key;
+    Message.ThreadId = FPlatformTLS::GetCurrentThreadId();
+    Message.Color = Color;
+    Message.Duration = Duration;
+    Message.LabelLength = DebugPrintQueue::CopyText(Message.Label, FDebugPrintMessage::MaxLabelLength, Label);
+    Message.ValueLength = DebugPrintQueue::CopyText(Message.Value, FDebugPrintMessage::MaxValueLength, Value);
+
+    Slot->Sequence.store(Position + 1, std::memory_order_release);
+    return true;
+}
+
+void FDebugPrintQueue::Drain()
+{
+    check(IsInGameThread());
+    DEBUGPRINT_SCOPE_CYCLE_COUNTER(STAT_DebugPrint_Drain);
+
+    FSlot* const Ring = Slots.load(std::memory_order_acquire);
+    if (!Ring || !FDebugPrintCategories::Get().IsPrintingEnabled())
+    {
+        return;
+    }
+
+    for (;;)
+    {
+        FSlot& Slot = Ring[DequeuePosition & Mask];
+        if (Slot.Sequence.load(std::memory_order_acquire) != DequeuePosition + 1)
+        {
+            break;
+        }
+
+        const FDebugPrintMessage& Message = Slot.Message;
+        FDebugPrintEntry& Entry = FDebugPrintRenderer::Get().AddEntry(
+            Message.Key, nullptr, Message.Color, Message.Duration, Message.ThreadId);
+
+        Entry.bAlignColumns = Message.LabelLength > 0;
+        Entry.Cells.SetNum(1);
+        FDebugPrintCell& Cell = Entry.Cells[0];
+        Cell.Label.Reset();
+        Cell.Label.AppendChars(Message.Label, Message.LabelLength);
+        Cell.Value.Reset();
+        Cell.Value.AppendChars(Message.Value, Message.ValueLength);
+        DebugPrintStats::CountMessage(1, (Message.LabelLength + Message.ValueLength) * sizeof(TCHAR));
+
+        // Hand the slot back to the producers one lap later
+        Slot.Sequence.store(DequeuePosition + Mask + 1, std::memory_order_release);
+        ++DequeuePosition;
+    }
+
+    if (!bReportedDropped && GetNumDropped() > 0)
+    {
+        UE_LOG(LogDebugPrint, Warning, TEXT("DebugPrint queue is full, messages are dropped. Increase Thread Queue Size in the plugin settings"));
+        bReportedDropped = true;
+    }
+}
+
+bool FDebugPrintQueue::Tick(float DeltaTime)
+{
+    Drain();
+    return true;
+}
+
+namespace DebugPrint
+{
+    void Print(FName Key, FStringView Label, double Value, FLinearColor Color, float Duration)
+    {
+        TCHAR Buffer[64];
+        const int32 Length = FCString::Snprintf(Buffer, UE_ARRAY_COUNT(Buffer), TEXT("%g"), Value);
+        FDebugPrintQueue::Get().Enqueue(Key, Label, FStringView(Buffer, FMath::Max(Length, 0)), Color, Duration);
+    }
+
+    void Print(FName Key, FStringView Label, int64 Value, FLinearColor Color, float Duration)
+    {
+        TCHAR Buffer[32];
+        const int32 Length = FCString::Snprintf(Buffer, UE_ARRAY_COUNT(Buffer), TEXT("%lld"), static_cast<long long>(Value));
+        FDebugPrintQueue::Get().Enqueue(Key, Label, FStringView(Buffer, FMath::Max(Length, 0)), Color, Duration);
+    }
+}
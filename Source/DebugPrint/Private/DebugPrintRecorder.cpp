@@ -0,0 +1,355 @@
+// Copyright MoxAlehin. All Rights Reserved.
+
+#include "DebugPrintRecorder.h"
+
+#include "HAL/Event.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/Compression.h"
+#include "Misc/Paths.h"
+#include "DebugPrint.h"
+#include "DebugPrintDescriptor.h"
+#include "DebugPrintDeveloperSettings.h"
+#include "DebugPrintStats.h"
+
+namespace DebugPrintRecorder
+{
+    using namespace DebugPrintCapture;
+
+    // Records are serialized on the stack, so typical calls don't allocate
+    using FRecordBuffer = TArray<uint8, TInlineAllocator<1024>>;
+
+    // Uncompressed size of a chunk written by the background thread
+    constexpr uint32 ChunkSize = 256 * 1024;
+
+    template <typename T>
+    void Write(FRecordBuffer& Buffer, const T& Value)
+    {
+        Buffer.Append(reinterpret_cast<const uint8*>(&Value), sizeof(T));
+    }
+
+    void WriteString(FRecordBuffer& Buffer, const FString& Text)
+    {
+        FTCHARToUTF8 Utf8(*Text);
+        const uint16 Length = static_cast<uint16>(FMath::Min<int32>(Utf8.Length(), MAX_uint16));
+        Write(Buffer, Length);
+        Buffer.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Length);
+    }
+
+    void BeginRecord(FRecordBuffer& Buffer, ERecordType Type, const FGuid& NodeGuid, double Time)
+    {
+        Buffer.Reset();
+        Write(Buffer, uint32(0));
+        Write(Buffer, Type);
+        Write(Buffer, NodeGuid);
+        Write(Buffer, uint64(GFrameCounter));
+        Write(Buffer, Time);
+    }
+
+    void EndRecord(FRecordBuffer& Buffer)
+    {
+        const uint32 Size = Buffer.Num();
+        FMemory::Memcpy(Buffer.GetData(), &Size, sizeof(Size));
+    }
+
+    void WriteValue(FRecordBuffer& Buffer, const FDebugPrintValue& Value)
+    {
+        // Common types keep their binary form, the rest is stored as the text the overlay would show
+        if (const FProperty* Property = Value.Literal ? nullptr : Value.Property)
+        {
+            const FNumericProperty* NumericProperty = CastField<FNumericProperty>(Property);
+            const FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+
+            if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+            {
+                Write(Buffer, EValueType::Bool);
+                Write(Buffer, uint8(BoolProperty->GetPropertyValue(Value.Address) ? 1 : 0));
+                return;
+            }
+            if (NumericProperty && !NumericProperty->GetIntPropertyEnum())
+            {
+                if (NumericProperty->IsFloatingPoint())
+                {
+                    Write(Buffer, EValueType::Double);
+                    Write(Buffer, NumericProperty->GetFloatingPointPropertyValue(Value.Address));
+                }
+                else
+                {
+                    Write(Buffer, EValueType::Int);
+                    Write(Buffer, NumericProperty->GetSignedIntPropertyValue(Value.Address));
+                }
+                return;
+            }
+            if (StructProperty && StructProperty->Struct == TBaseStructure<FVector>::Get())
+            {
+                const FVector& Vector = *static_cast<const FVector*>(Value.Address);
+                Write(Buffer, EValueType::Vector);
+                Write(Buffer, double(Vector.X));
+                Write(Buffer, double(Vector.Y));
+                Write(Buffer, double(Vector.Z));
+                return;
+            }
+            if (StructProperty && StructProperty->Struct == TBaseStructure<FRotator>::Get())
+            {
+                const FRotator& Rotator = *static_cast<const FRotator*>(Value.Address);
+                Write(Buffer, EValueType::Rotator);
+                Write(Buffer, double(Rotator.Pitch));
+                Write(Buffer, double(Rotator.Yaw));
+                Write(Buffer, double(Rotator.Roll));
+                return;
+            }
+        }
+
+        FDebugPrintScratchString Text;
+        FDebugPrintFormatter::AppendValue(*Text, Value);
+        Write(Buffer, EValueType::String);
+        WriteString(Buffer, *Text);
+    }
+
+    FAutoConsoleCommand StartCommand(TEXT("DebugPrint.Record.Start"),
+        TEXT("Starts recording DebugPrint values to Saved/DebugPrint. Optional argument: session name."),
+        FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+        {
+            FDebugPrintRecorder::Get().Start(Args.Num() > 0 ? Args[0] : FString());
+        }));
+
+    FAutoConsoleCommand StopCommand(TEXT("DebugPrint.Record.Stop"),
+        TEXT("Stops recording DebugPrint values and closes the capture file."),
+        FConsoleCommandDelegate::CreateLambda([]()
+        {
+            FDebugPrintRecorder::Get().Stop();
+        }));
+}
+
+FDebugPrintRecorder& FDebugPrintRecorder::Get()
+{
+    static FDebugPrintRecorder Recorder;
+    return Recorder;
+}
+
+bool FDebugPrintRecorder::Start(const FString& SessionName)
+{
+    check(IsInGameThread());
+    Stop();
+
+    const FString Name = SessionName.IsEmpty() ? FString::Printf(TEXT("Session_%s"), *FDateTime::Now().ToString()) : SessionName;
+    const FString Path = FPaths::ProjectSavedDir() / TEXT("DebugPrint") / Name + TEXT(".dprec");
+
+    Writer = IFileManager::Get().CreateFileWriter(*Path);
+    if (!Writer)
+    {
+        UE_LOG(LogDebugPrint, Warning, TEXT("Can't create DebugPrint capture %s"), *Path);
+        return false;
+    }
+
+    uint32 FileMagic = DebugPrintCapture::Magic;
+    uint32 FileVersion = DebugPrintCapture::Version;
+    *Writer << FileMagic << FileVersion;
+
+    Ring.Init(GetDefault<UDebugPrintDeveloperSettings>()->RecordingBufferSize * 1024);
+    RecordedNodes.Reset();
+    NumDroppedRecords = 0;
+    StartTime = FPlatformTime::Seconds();
+
+    bStopping = false;
+    WakeEvent = FPlatformProcess::GetSynchEventFromPool();
+    Thread = FRunnableThread::Create(this, TEXT("DebugPrintRecorder"), 0, TPri_BelowNormal);
+    bRecording = true;
+
+    UE_LOG(LogDebugPrint, Log, TEXT("Recording DebugPrint values to %s"), *Path);
+    return true;
+}
+
+void FDebugPrintRecorder::Stop()
+{
+    check(IsInGameThread());
+    if (!Thread)
+    {
+        return;
+    }
+
+    // The writer thread drains the ring before it exits
+    bRecording = false;
+    bStopping = true;
+    WakeEvent->Trigger();
+    Thread->WaitForCompletion();
+
+    delete Thread;
+    Thread = nullptr;
+    FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+    WakeEvent = nullptr;
+
+    Writer->Close();
+    delete Writer;
+    Writer = nullptr;
+
+    if (NumDroppedRecords > 0)
+    {
+        UE_LOG(LogDebugPrint, Warning, TEXT("DebugPrint recording dropped %u records, increase the recording buffer size."),
+            NumDroppedRecords.load());
+    }
+}
+
+void FDebugPrintRecorder::Record(
+    const FGuid& NodeGuid, const FDebugPrintNodeDescriptor& Descriptor, TConstArrayView<FDebugPrintValue> Values)
+{
+    using namespace DebugPrintRecorder;
+    DEBUGPRINT_SCOPE_CYCLE_COUNTER(STAT_DebugPrint_Record);
+
+    FRecordBuffer Buffer;
+    const double Time = FPlatformTime::Seconds() - StartTime;
+
+    // The layout is written once per node and capture, so value records stay small. Replays format the values with it
+    bool bNodeRecorded = false;
+    RecordedNodes.Add(NodeGuid, &bNodeRecorded);
+    if (!bNodeRecorded)
+    {
+        BeginRecord(Buffer, ERecordType::Node, NodeGuid, Time);
+        Write(Buffer, Descriptor.PrintType);
+        Write(Buffer, Descriptor.bSeparatorInLayout ? ENodeFlags::SeparatorInLayout : ENodeFlags::None);
+        WriteString(Buffer, Descriptor.Separator);
+        Write(Buffer, static_cast<uint16>(Descriptor.Values.Num()));
+        for (const FDebugPrintValueLayout& Layout : Descriptor.Values)
+        {
+            WriteString(Buffer, Layout.Label);
+            WriteString(Buffer, Layout.LabelPrefix);
+            Write(Buffer, static_cast<int8>(FMath::Clamp(Layout.NumberFormat.Precision, -1, int32(MAX_int8))));
+            Write(Buffer, static_cast<uint8>(FMath::Clamp(Layout.NumberFormat.MinWidth, 0, int32(MAX_uint8))));
+        }
+        EndRecord(Buffer);
+
+        if (!Ring.Push(Buffer.GetData(), Buffer.Num()))
+        {
+            RecordedNodes.Remove(NodeGuid);
+            NumDroppedRecords++;
+            return;
+        }
+    }
+
+    BeginRecord(Buffer, ERecordType::Values, NodeGuid, Time);
+    Write(Buffer, static_cast<uint16>(Values.Num()));
+    for (const FDebugPrintValue& Value : Values)
+    {
+        WriteValue(Buffer, Value);
+    }
+    EndRecord(Buffer);
+
+    if (!Ring.Push(Buffer.GetData(), Buffer.Num()))
+    {
+        NumDroppedRecords++;
+    }
+}
+
+uint32 FDebugPrintRecorder::Run()
+{
+    while (!bStopping)
+    {
+        WakeEvent->Wait(50);
+        while (Flush()) {}
+    }
+
+    while (Flush()) {}
+    return 0;
+}
+
+bool FDebugPrintRecorder::Flush()
+{
+    using namespace DebugPrintRecorder;
+
+    PendingRecords.Reset();
+    Ring.Pop(PendingRecords, ChunkSize);
+    if (PendingRecords.Num() == 0)
+    {
+        return false;
+    }
+
+    // Frame range of the chunk, so a reader can find frames without decompressing
+    uint64 FirstFrame = MAX_uint64;
+    uint64 LastFrame = 0;
+    for (int32 Offset = 0; Offset < PendingRecords.Num();)
+    {
+        uint32 Size;
+        uint64 Frame;
+        FMemory::Memcpy(&Size, &PendingRecords[Offset], sizeof(Size));
+        FMemory::Memcpy(&Frame, &PendingRecords[Offset + sizeof(uint32) + sizeof(uint8) + sizeof(FGuid)], sizeof(Frame));
+        FirstFrame = FMath::Min(FirstFrame, Frame);
+        LastFrame = FMath::Max(LastFrame, Frame);
+        Offset += Size;
+    }
+
+    // Chunks that don't compress are stored as they are, with equal sizes
+    uint32 UncompressedSize = PendingRecords.Num();
+    int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Zlib, UncompressedSize);
+    CompressedRecords.SetNumUninitialized(CompressedSize);
+    if (!FCompression::CompressMemory(NAME_Zlib, CompressedRecords.GetData(), CompressedSize, PendingRecords.GetData(), UncompressedSize) ||
+        static_cast<uint32>(CompressedSize) >= UncompressedSize)
+    {
+        CompressedSize = UncompressedSize;
+        CompressedRecords = PendingRecords;
+    }
+
+    uint32 ChunkCompressedSize = CompressedSize;
+    *Writer << UncompressedSize << ChunkCompressedSize << FirstFrame << LastFrame;
+    Writer->Serialize(CompressedRecords.GetData(), CompressedSize);
+    return true;
+}
+
+void FDebugPrintRecorder::FRing::Init(uint32 Capacity)
+{
+    Buffer.SetNumZeroed(FMath::RoundUpToPowerOfTwo(FMath::Max<uint32>(Capacity, 64 * 1024)));
+    Mask = Buffer.Num() - 1;
+    WriteIndex = 0;
+    ReadIndex = 0;
+}
+
+bool FDebugPrintRecorder::FRing::Push(const uint8* Data, uint32 Size)
+{
+    const uint64 Write = WriteIndex.load(std::memory_order_relaxed);
+    const uint64 Read = ReadIndex.load(std::memory_order_acquire);
+    if (Write - Read + Size > static_cast<uint64>(Buffer.Num()))
+    {
+        return false;
+    }
+
+    const uint32 Offset = static_cast<uint32>(Write & Mask);
+    const uint32 FirstPart = FMath::Min<uint32>(Size, Buffer.Num() - Offset);
+    FMemory::Memcpy(&Buffer[Offset], Data, FirstPart);
+    FMemory::Memcpy(Buffer.GetData(), Data + FirstPart, Size - FirstPart);
+
+    WriteIndex.store(Write + Size, std::memory_order_release);
+    return true;
+}
+
+void FDebugPrintRecorder::FRing::Pop(TArray<uint8>& Out, uint32 MaxBytes)
+{
+    uint64 Read = ReadIndex.load(std::memory_order_relaxed);
+    const uint64 Write = WriteIndex.load(std::memory_order_acquire);
+
+    // Records are pushed whole, so a visible size means the whole record is visible
+    uint32 NumPopped = 0;
+    while (Write - Read >= sizeof(uint32))
+    {
+        uint32 Size;
+        Copy(Read, reinterpret_cast<uint8*>(&Size), sizeof(Size));
+        if (NumPopped > 0 && NumPopped + Size > MaxBytes)
+        {
+            break;
+        }
+
+        const int32 OutOffset = Out.AddUninitialized(Size);
+        Copy(Read, Out.GetData() + OutOffset, Size);
+        Read += Size;
+        NumPopped += Size;
+    }
+
+    ReadIndex.store(Read, std::memory_order_release);
+}
+
+void FDebugPrintRecorder::FRing::Copy(uint64 Position, uint8* Dest, uint32 Size) const
+{
+    const uint32 Offset = static_cast<uint32>(Position & Mask);
+    const uint32 FirstPart = FMath::Min<uint32>(Size, Buffer.Num() - Offset);
+    FMemory::Memcpy(Dest, &Buffer[Offset], FirstPart);
+    FMemory::Memcpy(Dest + FirstPart, Buffer.GetData(), Size - FirstPart);
+}
@@ -0,0 +1,387 @@
+// Copyright MoxAlehin. All Rights Reserved.
+
+#include "DebugPrintRenderer.h"
+
+#include "CanvasItem.h"
+#include "Debug/DebugDrawService.h"
+#include "Engine/Canvas.h"
+#include "Engine/Engine.h"
+#include "Engine/Font.h"
+#include "EngineFontServices.h"
+#include "Fonts/FontCache.h"
+#include "GameFramework/PlayerController.h"
+#include "DebugPrintDeveloperSettings.h"
+#include "DebugPrintStats.h"
+
+namespace DebugPrintRenderer
+{
+    // Vertical gap between entries
+    constexpr float EntrySpacing = 4.f;
+
+    // Horizontal gap between a graph and the text around it
+    constexpr float GraphSpacing = 6.f;
+
+    const FLinearColor GraphBackground(0.f, 0.f, 0.f, 0.4f);
+
+    void DrawGraph(UCanvas* Canvas, const FDebugPrintHistory& History, FVector2D Position, FVector2D Size, FLinearColor Color)
+    {
+        FCanvasTileItem Background(Position, Size, GraphBackground);
+        Background.BlendMode = SE_BLEND_Translucent;
+        Canvas->DrawItem(Background);
+
+        // A flat history is drawn through the middle
+        const float Range = History.GetMax() - History.GetMin();
+        const float Scale = Range > UE_SMALL_NUMBER ? Size.Y / Range : 0.f;
+        const float StepX = Size.X / FMath::Max(History.Num() - 1, 1);
+
+        auto GetPoint = [&](int32 Index)
+        {
+            const float Height = Scale > 0.f ? (History[Index] - History.GetMin()) * Scale : Size.Y * 0.5f;
+            return FVector2D(Position.X + Index * StepX, Position.Y + Size.Y - Height);
+        };
+
+        FVector2D Previous = GetPoint(0);
+        for (int32 Index = 1; Index < History.Num(); ++Index)
+        {
+            const FVector2D Current = GetPoint(Index);
+            FCanvasLineItem Line(Previous, Current);
+            Line.SetColor(Color);
+            Canvas->DrawItem(Line);
+            Previous = Current;
+        }
+    }
+}
+
+void FDebugPrintHistory::SetCapacity(int32 Capacity)
+{
+    if (Samples.Num() != Capacity)
+    {
+        Samples.SetNumUninitialized(Capacity);
+        Reset();
+    }
+}
+
+void FDebugPrintHistory::Add(float Sample)
+{
+    if (Samples.Num() == 0)
+    {
+        return;
+    }
+
+    const bool bFull = NumSamples == Samples.Num();
+    const float Overwritten = Samples[NextSample];
+
+    Samples[NextSample] = Sample;
+    NextSample = (NextSample + 1) % Samples.Num();
+    NumSamples = FMath::Min(NumSamples + 1, Samples.Num());
+
+    if (NumSamples == 1)
+    {
+        Min = Max = Sample;
+    }
+    else if (bFull && (Overwritten <= Min || Overwritten >= Max))
+    {
+        // The dropped sample was an extreme, so look for the new one
+        Min = Max = Sample;
+        for (int32 Index = 0; Index < NumSamples; ++Index)
+        {
+            Min = FMath::Min(Min, Samples[Index]);
+            Max = FMath::Max(Max, Samples[Index]);
+        }
+    }
+    else
+    {
+        Min = FMath::Min(Min, Sample);
+        Max = FMath::Max(Max, Sample);
+    }
+}
+
+void FDebugPrintHistory::Reset()
+{
+    NextSample = 0;
+    NumSamples = 0;
+    Min = Max = 0.f;
+}
+
+FDebugPrintRenderer& FDebugPrintRenderer::Get()
+{
+    static FDebugPrintRenderer Renderer;
+    return Renderer;
+}
+
+void FDebugPrintRenderer::Register()
+{
+    if (!DrawHandle.IsValid())
+    {
+        DrawHandle = UDebugDrawService::Register(TEXT("Game"), FDebugDrawDelegate::CreateRaw(this, &FDebugPrintRenderer::Draw));
+    }
+}
+
+void FDebugPrintRenderer::Unregister()
+{
+    if (DrawHandle.IsValid())
+    {
+        UDebugDrawService::Unregister(DrawHandle);
+        DrawHandle.Reset();
+    }
+
+    Clear();
+}
+
+void FDebugPrintRenderer::Clear()
+{
+    Entries.Empty();
+    KeyToIndex.Empty();
+    WorldDrawFrames.Empty();
+}
+
+FDebugPrintEntry& FDebugPrintRenderer::AddEntry(
+    FName Key, const UObject* WorldContextObject, FLinearColor Color, float Duration, uint32 KeyNamespace)
+{
+    const TPair<FName, uint32> NamespacedKey(Key, KeyNamespace);
+
+    FDebugPrintEntry* Entry = nullptr;
+    if (!Key.IsNone())
+    {
+        if (const int32* Index = KeyToIndex.Find(NamespacedKey))
+        {
+            Entry = &Entries[*Index];
+        }
+        else if (KeyToIndex.Num() >= GetDefault<UDebugPrintDeveloperSettings>()->MaxDynamicKeys)
+        {
+            // Reuse the oldest keyed entry, so per-instance keys cannot grow the buffer without end
+            for (FDebugPrintEntry& OldEntry : Entries)
+            {
+                if (!OldEntry.Key.IsNone())
+                {
+                    KeyToIndex.Remove(TPair<FName, uint32>(OldEntry.Key, OldEntry.KeyNamespace));
+                    KeyToIndex.Add(NamespacedKey, UE_PTRDIFF_TO_INT32(&OldEntry - Entries.GetData()));
+                    Entry = &OldEntry;
+                    break;
+                }
+            }
+        }
+    }
+
+    if (!Entry)
+    {
+        // Expire entries here as well, so they also go away in worlds that are never drawn
+        if (LastExpireFrame != GFrameCounter)
+        {
+            RemoveExpiredEntries(FPlatformTime::Seconds());
+        }
+
+        // Drop the oldest unkeyed entry, so prints without a key cannot grow the buffer without end
+        if (Key.IsNone() && Entries.Num() - KeyToIndex.Num() >= GetDefault<UDebugPrintDeveloperSettings>()->MaxUnkeyedEntries)
+        {
+            const int32 OldestIndex = Entries.IndexOfByPredicate([](const FDebugPrintEntry& OldEntry) { return OldEntry.Key.IsNone(); });
+            if (OldestIndex != INDEX_NONE)
+            {
+                Entries.RemoveAt(OldestIndex);
+                RebuildKeyToIndex();
+            }
+        }
+
+        const int32 Index = Entries.AddDefaulted();
+        Entry = &Entries[Index];
+        if (!Key.IsNone()) KeyToIndex.Add(NamespacedKey, Index);
+    }
+
+    Entry->Key = Key;
+    Entry->KeyNamespace = KeyNamespace;
+    Entry->Color = Color;
+    Entry->ExpireTime = FPlatformTime::Seconds() + Duration;
+    Entry->bDrawn = false;
+    Entry->bDrawOnce = Duration <= 0.f;
+    Entry->World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+    Entry->Owner = WorldContextObject;
+    Entry->NodeGuid.Invalidate();
+    return *Entry;
+}
+
+FDebugPrintEntry* FDebugPrintRenderer::FindEntry(FName Key, uint32 KeyNamespace)
+{
+    const int32* Index = KeyToIndex.Find(TPair<FName, uint32>(Key, KeyNamespace));
+    return Index ? &Entries[*Index] : nullptr;
+}
+
+void FDebugPrintRenderer::ForEachEntry(TFunctionRef<void(FDebugPrintEntry&)> Callback)
+{
+    for (FDebugPrintEntry& Entry : Entries)
+    {
+        Callback(Entry);
+    }
+}
+
+void FDebugPrintRenderer::Draw(UCanvas* Canvas, APlayerController* PlayerController)
+{
+    using namespace DebugPrintRenderer;
+    DEBUGPRINT_SCOPE_CYCLE_COUNTER(STAT_DebugPrint_Draw);
+
+    RemoveExpiredEntries(FPlatformTime::Seconds());
+    if (!Canvas || !GEngine || !GAreScreenMessagesEnabled || Entries.Num() == 0)
+    {
+        return;
+    }
+
+    // A new font invalidates every glyph run and measured column
+    if (UpdateFont())
+    {
+        for (FDebugPrintEntry& Entry : Entries)
+        {
+            for (FDebugPrintCell& Cell : Entry.Cells)
+            {
+                Cell.ShapedLabel.Reset();
+                Cell.ShapedValue.Reset();
+            }
+        }
+    }
+
+    TSharedPtr<FSlateFontCache> FontCache = FEngineFontServices::Get().GetFontCache();
+    if (!FontCache.IsValid())
+    {
+        return;
+    }
+
+    const float LineHeight = FontCache->GetMaxCharacterHeight(FontInfo, 1.f);
+    const UWorld* CanvasWorld = PlayerController ? PlayerController->GetWorld() : nullptr;
+    WorldDrawFrames.Add(FObjectKey(CanvasWorld), GFrameCounter);
+    const UDebugPrintDeveloperSettings* Settings = GetDefault<UDebugPrintDeveloperSettings>();
+    const FVector2D Origin = Settings->OverlayOrigin;
+
+    const float X = Canvas->SafeZonePadX + Origin.X;
+    float Y = Canvas->SafeZonePadY + Origin.Y;
+
+    for (FDebugPrintEntry& Entry : Entries)
+    {
+        // In multiplayer Play In Editor every viewport only shows the entries of its own world
+        const UWorld* EntryWorld = Entry.World.Get();
+        if (CanvasWorld && EntryWorld && CanvasWorld != EntryWorld)
+        {
+            continue;
+        }
+
+        // Labels get their own column, measured again only when one of them was reshaped
+        bool bLabelsChanged = false;
+        for (FDebugPrintCell& Cell : Entry.Cells)
+        {
+            if (Entry.bAlignColumns) bLabelsChanged |= ShapeText(Cell.Label, Cell.ShapedLabelText, Cell.ShapedLabel);
+            ShapeText(Cell.Value, Cell.ShapedValueText, Cell.ShapedValue);
+        }
+
+        if (!Entry.bAlignColumns)
+        {
+            Entry.LabelWidth = 0.f;
+        }
+        else if (bLabelsChanged)
+        {
+            Entry.LabelWidth = 0.f;
+            for (const FDebugPrintCell& Cell : Entry.Cells)
+            {
+                Entry.LabelWidth = FMath::Max(Entry.LabelWidth, Cell.ShapedLabel->GetMeasuredWidth());
+            }
+        }
+
+        for (const FDebugPrintCell& Cell : Entry.Cells)
+        {
+            if (Entry.bAlignColumns)
+            {
+                FCanvasShapedTextItem LabelItem(FVector2D(X, Y), Cell.ShapedLabel.ToSharedRef(), Entry.Color);
+                LabelItem.EnableShadow(FLinearColor::Black);
+                Canvas->DrawItem(LabelItem);
+            }
+
+            float ValueX = X + Entry.LabelWidth;
+            if (Cell.History.IsValid() && !Cell.History->IsEmpty())
+            {
+                const FVector2D GraphSize(Settings->GraphWidth, FMath::Max(LineHeight - 2.f, 1.f));
+                DrawGraph(Canvas, *Cell.History, FVector2D(ValueX + GraphSpacing, Y + 1.f), GraphSize, Entry.Color);
+                ValueX += GraphSize.X + GraphSpacing * 2.f;
+            }
+
+            FCanvasShapedTextItem ValueItem(FVector2D(ValueX, Y), Cell.ShapedValue.ToSharedRef(), Entry.Color);
+            ValueItem.EnableShadow(FLinearColor::Black);
+            Canvas->DrawItem(ValueItem);
+
+            Y += LineHeight;
+        }
+
+        Y += EntrySpacing;
+        Entry.bDrawn = true;
+    }
+}
+
+bool FDebugPrintRenderer::UpdateFont()
+{
+    const UDebugPrintDeveloperSettings* Settings = GetDefault<UDebugPrintDeveloperSettings>();
+    if (LoadedFont.IsValid() && LoadedFontPath == Settings->OverlayFont && FontInfo.Size == Settings->OverlayFontSize)
+    {
+        return false;
+    }
+
+    UObject* Font = Settings->OverlayFont.TryLoad();
+    if (!Font)
+    {
+        Font = GEngine->GetSmallFont();
+    }
+
+    // The renderer is not a UObject, so it keeps the font alive itself
+    LoadedFont.Reset(Font);
+    LoadedFontPath = Settings->OverlayFont;
+    FontInfo = FSlateFontInfo(Font, Settings->OverlayFontSize);
+    return true;
+}
+
+bool FDebugPrintRenderer::ShapeText(
+    const FString& Text, FString& ShapedText, TSharedPtr<const FShapedGlyphSequence>& ShapedSequence) const
+{
+    if (ShapedSequence.IsValid() && !ShapedSequence->IsDirty() && ShapedText.Equals(Text, ESearchCase::CaseSensitive))
+    {
+        return false;
+    }
+
+    ShapedText = Text;
+    ShapedSequence = FEngineFontServices::Get().GetFontCache()->ShapeBidirectionalText(
+        Text, FontInfo, 1.f, TextBiDi::ETextDirection::LeftToRight, ETextShapingMethod::Auto);
+    return true;
+}
+
+void FDebugPrintRenderer::RemoveExpiredEntries(double Now)
+{
+    LastExpireFrame = GFrameCounter;
+    for (auto It = WorldDrawFrames.CreateIterator(); It; ++It)
+    {
+        if (It.Value() + 1 < GFrameCounter) It.RemoveCurrent();
+    }
+
+    // Zero duration entries are drawn at least once, unless nothing draws their world
+    const int32 NumRemoved = Entries.RemoveAll([this, Now](const FDebugPrintEntry& Entry)
+    {
+        return Entry.ExpireTime <= Now && (Entry.bDrawn || !Entry.bDrawOnce || !IsWorldDrawing(Entry.World.Get()));
+    });
+
+    if (NumRemoved > 0)
+    {
+        RebuildKeyToIndex();
+    }
+}
+
+void FDebugPrintRenderer::RebuildKeyToIndex()
+{
+    KeyToIndex.Reset();
+    for (int32 Index = 0; Index < Entries.Num(); ++Index)
+    {
+        const FDebugPrintEntry& Entry = Entries[Index];
+        if (!Entry.Key.IsNone()) KeyToIndex.Add(TPair<FName, uint32>(Entry.Key, Entry.KeyNamespace), Index);
+    }
+}
+
+bool FDebugPrintRenderer::IsWorldDrawing(const UWorld* World) const
+{
+    // Canvases without a world draw every entry, entries without a world are drawn by every canvas
+    if (WorldDrawFrames.Contains(FObjectKey()))
+    {
+        return true;
+    }
+    return World ? WorldDrawFrames.Contains(FObjectKey(World)) : WorldDrawFrames.Num() > 0;
+}
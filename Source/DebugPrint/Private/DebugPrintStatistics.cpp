@@ -0,0 +1,130 @@
+// Copyright MoxAlehin. All Rights Reserved.
+
+#include "DebugPrintStatistics.h"
+
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "DebugPrint.h"
+#include "DebugPrintLibrary.h"
+
+namespace DebugPrintStatistics
+{
+    void ResetAll()
+    {
+        UDebugPrintLibrary::ResetStatistics();
+    }
+
+    void Snapshot(const FString& Name)
+    {
+        FString Csv = TEXT("Node,Object,Label,Count,Min,Max,Mean,StdDev,WindowSamples,WindowMean\n");
+        UDebugPrintLibrary::ForEachStatistics([&Csv](const FGuid& NodeGuid, const UObject* Object, const FString& Label,
+            const FDebugPrintStatistics& Statistics)
+        {
+            const FString ObjectName = GetNameSafe(Object);
+            Csv += FString::Printf(TEXT("%s,\"%s\",\"%s\",%lld,%g,%g,%g,%g,%d,%g\n"), *NodeGuid.ToString(), *ObjectName,
+                *Label.Replace(TEXT("\""), TEXT("\"\"")), Statistics.GetCount(), Statistics.GetMin(), Statistics.GetMax(),
+                Statistics.GetMean(), Statistics.GetStdDev(), Statistics.GetWindowNum(), Statistics.GetWindowMean());
+
+            FString Summary;
+            Statistics.AppendSummary(Summary);
+            UE_LOG(LogDebugPrint, Display, TEXT("%s %s: %s"), *ObjectName, *Label, *Summary);
+        });
+
+        const FString FileName = Name.IsEmpty() ? FString::Printf(TEXT("Statistics_%s"), *FDateTime::Now().ToString()) : Name;
+        const FString Path = FPaths::ProjectSavedDir() / TEXT("DebugPrint") / FileName + TEXT(".csv");
+        if (FFileHelper::SaveStringToFile(Csv, *Path))
+        {
+            UE_LOG(LogDebugPrint, Display, TEXT("DebugPrint statistics written to %s"), *Path);
+        }
+        else
+        {
+            UE_LOG(LogDebugPrint, Warning, TEXT("Can't write DebugPrint statistics to %s"), *Path);
+        }
+    }
+
+    FAutoConsoleCommand ResetCommand(TEXT("DebugPrint.Stats.Reset"),
+        TEXT("Resets the aggregates of every value printed with Print Statistics."),
+        FConsoleCommandDelegate::CreateStatic(&ResetAll));
+
+    FAutoConsoleCommand SnapshotCommand(TEXT("DebugPrint.Stats.Snapshot"),
+        TEXT("Logs the aggregates of every value printed with Print Statistics and writes them to a CSV file in Saved/DebugPrint. ")
+        TEXT("Optional argument: file name."),
+        FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+        {
+            Snapshot(Args.Num() > 0 ? Args[0] : FString());
+        }));
+}
+
+void FDebugPrintStatistics::SetWindowSize(int32 WindowSize)
+{
+    WindowSize = FMath::Max(WindowSize, 1);
+    if (Window.Num() != WindowSize)
+    {
+        Window.SetNumUninitialized(WindowSize);
+        NextSample = 0;
+        NumWindowSamples = 0;
+        WindowSum = 0.0;
+    }
+}
+
+void FDebugPrintStatistics::Add(double Sample)
+{
+    Count++;
+    if (Count == 1)
+    {
+        Min = Max = Sample;
+    }
+    else
+    {
+        Min = FMath::Min(Min, Sample);
+        Max = FMath::Max(Max, Sample);
+    }
+
+    const double Delta = Sample - Mean;
+    Mean += Delta / double(Count);
+    SquaredDeviations += Delta * (Sample - Mean);
+
+    if (Window.Num() == 0)
+    {
+        return;
+    }
+
+    if (NumWindowSamples == Window.Num())
+    {
+        WindowSum -= Window[NextSample];
+    }
+    else
+    {
+        NumWindowSamples++;
+    }
+
+    Window[NextSample] = Sample;
+    WindowSum += Sample;
+    NextSample = (NextSample + 1) % Window.Num();
+
+    // Sum the window again once per lap, so rounding errors of the running sum don't build up
+    if (NextSample == 0)
+    {
+        WindowSum = 0.0;
+        for (int32 Index = 0; Index < NumWindowSamples; ++Index)
+        {
+            WindowSum += Window[Index];
+        }
+    }
+}
+
+void FDebugPrintStatistics::Reset()
+{
+    Count = 0;
+    Min = Max = Mean = SquaredDeviations = 0.0;
+    NextSample = 0;
+    NumWindowSamples = 0;
+    WindowSum = 0.0;
+}
+
+void FDebugPrintStatistics::AppendSummary(FString& Out) const
+{
+    Out.Appendf(TEXT("n %lld  mean %.4g  sd %.4g  min %.4g  max %.4g  last %d: %.4g"), Count, Mean, GetStdDev(), Min, Max,
+        NumWindowSamples, GetWindowMean());
+}
@@ -0,0 +1,74 @@
+// Copyright MoxAlehin. All Rights Reserved.
+
+#include "DebugPrintStats.h"
+
+#include "Misc/CoreDelegates.h"
+#include "DebugPrintRenderer.h"
+
+DEFINE_STAT(STAT_DebugPrint_Call);
+DEFINE_STAT(STAT_DebugPrint_Format);
+DEFINE_STAT(STAT_DebugPrint_Submit);
+DEFINE_STAT(STAT_DebugPrint_Record);
+DEFINE_STAT(STAT_DebugPrint_Drain);
+DEFINE_STAT(STAT_DebugPrint_Draw);
+DEFINE_STAT(STAT_DebugPrint_Messages);
+DEFINE_STAT(STAT_DebugPrint_Values);
+DEFINE_STAT(STAT_DebugPrint_BytesFormatted);
+DEFINE_STAT(STAT_DebugPrint_LiveKeys);
+
+UE_TRACE_CHANNEL_DEFINE(DebugPrintChannel);
+
+TRACE_DECLARE_INT_COUNTER(DebugPrint_Messages, TEXT("DebugPrint/Messages"));
+TRACE_DECLARE_INT_COUNTER(DebugPrint_Values, TEXT("DebugPrint/Values"));
+TRACE_DECLARE_INT_COUNTER(DebugPrint_BytesFormatted, TEXT("DebugPrint/Bytes Formatted"));
+TRACE_DECLARE_INT_COUNTER(DebugPrint_LiveKeys, TEXT("DebugPrint/Live Keys"));
+
+namespace DebugPrintStats
+{
+    // Totals of the current frame, published and reset at its end
+    int32 FrameMessages = 0;
+    int32 FrameValues = 0;
+    int32 FrameBytesFormatted = 0;
+
+    FDelegateHandle EndFrameHandle;
+
+    void EndFrame()
+    {
+        const int32 NumLiveKeys = FDebugPrintRenderer::Get().GetNumKeys();
+        SET_DWORD_STAT(STAT_DebugPrint_LiveKeys, NumLiveKeys);
+
+        TRACE_COUNTER_SET(DebugPrint_Messages, FrameMessages);
+        TRACE_COUNTER_SET(DebugPrint_Values, FrameValues);
+        TRACE_COUNTER_SET(DebugPrint_BytesFormatted, FrameBytesFormatted);
+        TRACE_COUNTER_SET(DebugPrint_LiveKeys, NumLiveKeys);
+
+        FrameMessages = 0;
+        FrameValues = 0;
+        FrameBytesFormatted = 0;
+    }
+
+    void CountMessage(int32 NumValues, int32 NumBytesFormatted)
+    {
+        INC_DWORD_STAT(STAT_DebugPrint_Messages);
+        INC_DWORD_STAT_BY(STAT_DebugPrint_Values, NumValues);
+        INC_DWORD_STAT_BY(STAT_DebugPrint_BytesFormatted, NumBytesFormatted);
+
+        FrameMessages++;
+        FrameValues += NumValues;
+        FrameBytesFormatted += NumBytesFormatted;
+    }
+
+    void Register()
+    {
+        if (!EndFrameHandle.IsValid())
+        {
+            EndFrameHandle = FCoreDelegates::OnEndFrame.AddStatic(&EndFrame);
+        }
+    }
+
+    void Unregister()
+    {
+        FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+        EndFrameHandle.Reset();
+    }
+}
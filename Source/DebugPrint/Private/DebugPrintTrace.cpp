@@ -0,0 +1,90 @@
+// Copyright MoxAlehin. All Rights Reserved.
+
+#include "DebugPrintTrace.h"
+
+#include "DebugPrintDescriptor.h"
+#include "DebugPrintFormatter.h"
+
+UE_TRACE_EVENT_BEGIN(DebugPrint, NumberValue)
+    UE_TRACE_EVENT_FIELD(uint64, Cycle)
+    UE_TRACE_EVENT_FIELD(uint32[], NodeGuid)
+    UE_TRACE_EVENT_FIELD(double, Value)
+    UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Label)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(DebugPrint, TextValue)
+    UE_TRACE_EVENT_FIELD(uint64, Cycle)
+    UE_TRACE_EVENT_FIELD(uint32[], NodeGuid)
+    UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Label)
+    UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Value)
+UE_TRACE_EVENT_END()
+
+namespace DebugPrintTrace
+{
+#if COUNTERSTRACE_ENABLED
+    struct FCounter
+    {
+        FString Label;
+        uint16 Id = 0;
+    };
+
+    // Insights counter of every numeric value, created the first time the value is traced. Game thread only
+    TMap<FGuid, TArray<FCounter>> Counters;
+
+    void SetCounter(const FGuid& NodeGuid, int32 Index, const FString& Label, double Number)
+    {
+        TArray<FCounter>& NodeCounters = Counters.FindOrAdd(NodeGuid);
+        if (NodeCounters.Num() <= Index)
+        {
+            NodeCounters.SetNum(Index + 1);
+        }
+
+        // A recompiled node may have renamed the value, which starts a new counter
+        FCounter& Counter = NodeCounters[Index];
+        if (Counter.Id == 0 || !Counter.Label.Equals(Label, ESearchCase::CaseSensitive))
+        {
+            Counter.Label = Label;
+            const FString Name = TEXT("DebugPrint/") + (Label.IsEmpty() ? FString::Printf(TEXT("Value %d"), Index) : Label);
+            Counter.Id = FCountersTrace::OutputInitCounter(*Name, TraceCounterType_Float, TraceCounterDisplayHint_None);
+        }
+
+        if (Counter.Id != 0)
+        {
+            FCountersTrace::OutputSetValue(Counter.Id, Number);
+        }
+    }
+#endif
+}
+
+void DebugPrintTrace::TraceValues(const FGuid& NodeGuid, const FDebugPrintNodeDescriptor& Descriptor,
+    TConstArrayView<FDebugPrintValue> Values)
+{
+    const uint64 Cycle = FPlatformTime::Cycles64();
+    FDebugPrintScratchString Text;
+    for (int32 i = 0; i < Values.Num(); i++)
+    {
+        const FString& Label = Descriptor.Values.IsValidIndex(i) ? Descriptor.Values[i].Label : FString();
+
+        double Number = 0.0;
+        if (FDebugPrintFormatter::GetNumber(Values[i], Number))
+        {
+            UE_TRACE_LOG(DebugPrint, NumberValue, DebugPrintChannel)
+                << NumberValue.Cycle(Cycle)
+                << NumberValue.NodeGuid(&NodeGuid.A, 4)
+                << NumberValue.Value(Number)
+                << NumberValue.Label(*Label, Label.Len());
+#if COUNTERSTRACE_ENABLED
+            SetCounter(NodeGuid, i, Label, Number);
+#endif
+            continue;
+        }
+
+        Text->Reset();
+        FDebugPrintFormatter::AppendValue(*Text, Values[i]);
+        UE_TRACE_LOG(DebugPrint, TextValue, DebugPrintChannel)
+            << TextValue.Cycle(Cycle)
+            << TextValue.NodeGuid(&NodeGuid.A, 4)
+            << TextValue.Label(*Label, Label.Len())
+            << TextValue.Value(**Text, Text->Len());
+    }
+}
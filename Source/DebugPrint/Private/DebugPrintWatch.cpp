@@ -0,0 +1,95 @@
+// Copyright MoxAlehin. All Rights Reserved.
+
+#include "DebugPrintWatch.h"
+
+#include "Misc/CoreDelegates.h"
+#include "Misc/ScopeLock.h"
+#include "DebugPrintRenderer.h"
+
+FDebugPrintWatch& FDebugPrintWatch::Get()
+{
+    static FDebugPrintWatch Watch;
+    return Watch;
+}
+
+void FDebugPrintWatch::Register()
+{
+    if (!EndFrameHandle.IsValid())
+    {
+        EndFrameHandle = FCoreDelegates::OnEndFrame.AddRaw(this, &FDebugPrintWatch::Publish);
+    }
+}
+
+void FDebugPrintWatch::Unregister()
+{
+    FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+    EndFrameHandle.Reset();
+
+    FScopeLock Lock(&SnapshotMutex);
+    FrontSnapshot.Reset();
+    BackSnapshot.Reset();
+}
+
+TSharedPtr<const FDebugPrintWatchSnapshot, ESPMode::ThreadSafe> FDebugPrintWatch::GetSnapshot() const
+{
+    FScopeLock Lock(&SnapshotMutex);
+    return FrontSnapshot;
+}
+
+void FDebugPrintWatch::Publish()
+{
+    if (!IsWatched())
+    {
+        return;
+    }
+
+    // The back snapshot is reused unless a reader still holds it from before the last swap
+    if (!BackSnapshot.IsValid() || !BackSnapshot.IsUnique())
+    {
+        BackSnapshot = MakeShared<FDebugPrintWatchSnapshot, ESPMode::ThreadSafe>();
+    }
+
+    FDebugPrintWatchSnapshot& Snapshot = *BackSnapshot;
+    Snapshot.Frame = GFrameCounter;
+
+    // Rows keep their strings, so refilling them mostly reuses the memory of the frame before last
+    int32 NumRows = 0;
+    const double Now = FPlatformTime::Seconds();
+    FDebugPrintRenderer::Get().ForEachEntry([&Snapshot, &NumRows, Now](FDebugPrintEntry& Entry)
+    {
+        if (Entry.ExpireTime < Now)
+        {
+            return;
+        }
+
+        const UObject* Owner = Entry.Owner.Get();
+        for (const FDebugPrintCell& Cell : Entry.Cells)
+        {
+            if (NumRows == Snapshot.Rows.Num())
+            {
+                Snapshot.Rows.AddDefaulted();
+            }
+
+            FDebugPrintWatchRow& Row = Snapshot.Rows[NumRows++];
+            Row.NodeGuid = Entry.NodeGuid;
+            Row.Color = Entry.Color;
+            Row.Label = Cell.Label;
+            Row.Value = Cell.Value;
+            if (Owner)
+            {
+                Row.Blueprint = Owner->GetClass()->GetName();
+                Row.Blueprint.RemoveFromEnd(TEXT("_C"));
+                Row.Instance = Owner->GetName();
+            }
+            else
+            {
+                Row.Blueprint = Entry.NodeGuid.IsValid() ? TEXT("Unknown") : TEXT("Native");
+                Row.Instance.Reset();
+            }
+        }
+    });
+    Snapshot.Rows.SetNum(NumRows);
+
+    FScopeLock Lock(&SnapshotMutex);
+    Swap(FrontSnapshot, BackSnapshot);
+}
@@ -5,6 +5,8 @@
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
 
+DEBUGPRINT_API DECLARE_LOG_CATEGORY_EXTERN(LogDebugPrint, Log, All);
+
 class FDebugPrintModule : public IModuleInterface
 {
 public:
@@ -0,0 +1,100 @@
+// Copyright MoxAlehin. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DebugPrintFormatter.h"
+#include "DebugPrintTypes.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+// A node seen in a capture, with the layout its values are formatted with
+struct FDebugPrintCaptureNode
+{
+    FGuid NodeGuid;
+    TArray<FString> Labels;
+    TArray<FString> LabelPrefixes;
+    TArray<FDebugPrintNumberFormat> NumberFormats;
+    EPrintType PrintType = EPrintType::PrintInColumns;
+    FString Separator;
+    bool bSeparatorInLayout = false;
+    uint64 FirstFrame = MAX_uint64;
+    uint64 LastFrame = 0;
+};
+
+// What a node showed at a frame: the values of its last record at or before that frame, formatted and laid out
+// like the overlay showed them. Print types that show no label column have empty labels
+struct FDebugPrintCaptureTable
+{
+    FGuid NodeGuid;
+    uint64 Frame = 0;
+    double Time = 0.0;
+    TArray<FString> Labels;
+    TArray<FString> Values;
+};
+
+// Reads a capture written by FDebugPrintRecorder. The file is memory mapped and indexed once when it's opened:
+// the frame range of every chunk and, for every node, the chunks holding its records with the first frame
+// of the node in each. Seeking to a frame is then a binary search per node and one pass over the chunks found.
+class DEBUGPRINT_API FDebugPrintCaptureReader
+{
+public:
+    FDebugPrintCaptureReader();
+    ~FDebugPrintCaptureReader();
+
+    // Maps and indexes the capture. On failure the reason is written to OutError
+    bool Open(const FString& Path, FString& OutError);
+    void Close();
+
+    bool IsOpen() const { return Data != nullptr; }
+    const FString& GetPath() const { return Path; }
+
+    uint64 GetFirstFrame() const { return FirstFrame; }
+    uint64 GetLastFrame() const { return LastFrame; }
+    int32 GetNumChunks() const { return Chunks.Num(); }
+    const TArray<FDebugPrintCaptureNode>& GetNodes() const { return Nodes; }
+
+    // Fills the table of every node that printed at or before the frame, in the order the nodes first printed
+    void Seek(uint64 Frame, TArray<FDebugPrintCaptureTable>& OutTables);
+
+private:
+    struct FChunk
+    {
+        int64 DataOffset = 0;
+        uint32 UncompressedSize = 0;
+        uint32 CompressedSize = 0;
+        uint64 FirstFrame = 0;
+        uint64 LastFrame = 0;
+    };
+
+    // A chunk holding records of a node, with the frame of the first of them
+    struct FNodeChunk
+    {
+        int32 Chunk = 0;
+        uint64 FirstFrame = 0;
+    };
+
+    // Returns the records of the chunk, decompressing it unless it's in the cache or stored uncompressed
+    TConstArrayView<uint8> GetChunkRecords(int32 ChunkIndex);
+
+    FString Path;
+    TUniquePtr<IMappedFileHandle> MappedFile;
+    TUniquePtr<IMappedFileRegion> MappedRegion;
+    const uint8* Data = nullptr;
+    int64 Size = 0;
+
+    TArray<FChunk> Chunks;
+    uint64 FirstFrame = 0;
+    uint64 LastFrame = 0;
+
+    TArray<FDebugPrintCaptureNode> Nodes;
+    TArray<TArray<FNodeChunk>> NodeChunks;
+    TMap<FGuid, int32> NodeIndices;
+
+    // Recently decompressed chunks, so scrubbing back and forth doesn't decompress the same chunks again
+    static constexpr int32 MaxCachedChunks = 8;
+    TArray<TPair<int32, TArray<uint8>>> CachedChunks;
+
+    uint32 FileVersion = 0;
+};
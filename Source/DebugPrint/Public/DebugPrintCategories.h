@@ -0,0 +1,89 @@
+// Copyright MoxAlehin. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+// Runtime switches of DebugPrint, set with the DebugPrint.Enable and DebugPrint.Filter console commands.
+// Every category gets a bit the first time it's used. The bits are read without locks, so once the bit of a category
+// is known, checking it is a single atomic load from any thread.
+class DEBUGPRINT_API FDebugPrintCategories
+{
+public:
+    static constexpr int32 MaxCategories = 256;
+
+    static FDebugPrintCategories& Get();
+
+    // Returns the bit of the category, adding it on first use. INDEX_NONE for no category or when all bits are taken
+    int32 FindOrAddIndex(FName Category);
+
+    // Whether printing is enabled and the category with this bit passes the filter. Safe to call from any thread
+    bool IsEnabled(int32 Index) const
+    {
+        if (!bEnabled.load(std::memory_order_relaxed))
+        {
+            return false;
+        }
+        if (Index == INDEX_NONE)
+        {
+            return bDefaultEnabled.load(std::memory_order_relaxed);
+        }
+        return (Bits[Index >> 6].load(std::memory_order_relaxed) >> (Index & 63)) & 1;
+    }
+
+    // Same as above, finding the bit through a cache of the game thread. Game thread only
+    bool IsEnabled(FName Category);
+
+    // Whether any DebugPrint output is enabled at all
+    bool IsPrintingEnabled() const { return bEnabled.load(std::memory_order_relaxed); }
+    void SetPrintingEnabled(bool bInEnabled);
+
+    // Shows only the listed categories, or hides the ones starting with '-'. An empty filter shows everything.
+    // Nodes without a category are shown unless categories are listed
+    void SetFilter(const FString& Filter);
+    const FString& GetFilter() const { return Filter; }
+
+private:
+    FDebugPrintCategories();
+
+    std::atomic<bool> bEnabled{true};
+    std::atomic<bool> bDefaultEnabled{true};
+    std::atomic<uint64> Bits[MaxCategories / 64];
+
+    // Names of the categories by bit. Only touched when a category is added or the filter changes
+    FCriticalSection Mutex;
+    FName Names[MaxCategories];
+    int32 NumCategories = 0;
+    FString Filter;
+
+    TMap<FName, int32> GameThreadIndices;
+};
+
+// Category of native prints. Finds its bit on the first check, so keep it in a static:
+//
+//     static FDebugPrintCategory AICategory(TEXT("AI"));
+//     if (AICategory.IsEnabled()) DebugPrint::Print(...);
+class DEBUGPRINT_API FDebugPrintCategory
+{
+public:
+    explicit FDebugPrintCategory(FName InName) : Name(InName) {}
+
+    // Safe to call from any thread
+    bool IsEnabled() const
+    {
+        int32 Bit = Index.load(std::memory_order_relaxed);
+        if (Bit == Unresolved)
+        {
+            Bit = FDebugPrintCategories::Get().FindOrAddIndex(Name);
+            Index.store(Bit, std::memory_order_relaxed);
+        }
+        return FDebugPrintCategories::Get().IsEnabled(Bit);
+    }
+
+private:
+    static constexpr int32 Unresolved = -2;
+
+    FName Name;
+    mutable std::atomic<int32> Index{Unresolved};
+};
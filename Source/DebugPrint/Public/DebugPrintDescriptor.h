@@ -0,0 +1,104 @@
+// Copyright MoxAlehin. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DebugPrintFormatter.h"
+
+// Compile time layout of a single value
+struct DEBUGPRINT_API FDebugPrintValueLayout
+{
+    // Label of the value as shown in the label column
+    FString Label;
+
+    // Label of the value, already padded and joined with the separator
+    FString LabelPrefix;
+
+    // Text of an unlinked pin. Values without a literal are read from the Blueprint frame
+    TOptional<FString> Literal;
+
+    // Format of the numbers in the value
+    FDebugPrintNumberFormat NumberFormat;
+};
+
+// Compile time options of a node. Options without a literal are linked on the node and passed as variadic
+// arguments in front of the values, in the order they are declared here
+struct DEBUGPRINT_API FDebugPrintOptionsLayout
+{
+    TOptional<FString> Key;
+    TOptional<FString> Separator;
+    TOptional<FString> TextColor;
+    TOptional<FString> Duration;
+
+    // Value of the print type as a number
+    TOptional<FString> PrintType;
+
+    // Whether the separator is already part of the label prefixes
+    bool bSeparatorInLayout = false;
+
+    // Whether only the values that changed since the last execution are formatted again
+    bool bPrintOnChange = false;
+};
+
+// Per-node data that stays the same between executions. ExpandNode bakes it into a layout string,
+// the runtime decodes that string on the first execution of the node and reuses the result afterwards.
+struct DEBUGPRINT_API FDebugPrintNodeDescriptor
+{
+    // Options that are linked on the node and read from the Blueprint frame on every execution
+    enum class EDynamicOption : uint8
+    {
+        None = 0,
+        Key = 1 << 0,
+        Separator = 1 << 1,
+        TextColor = 1 << 2,
+        Duration = 1 << 3,
+        PrintType = 1 << 4
+    };
+
+    // Layout of every value in pin order
+    TArray<FDebugPrintValueLayout> Values;
+
+    // Number of values passed to the node as variadic arguments
+    int32 NumDynamicValues = 0;
+
+    // GUID of the node and its message key, used when no Key is provided
+    FGuid NodeGuid;
+    FName GuidKey;
+
+    // Values of the options that aren't linked
+    FName Key;
+    FString Separator;
+    FLinearColor TextColor = FLinearColor::White;
+    float Duration = 0.f;
+    uint8 PrintType = 0;
+
+    EDynamicOption DynamicOptions = EDynamicOption::None;
+
+    bool bSeparatorInLayout = false;
+    bool bPrintOnChange = false;
+
+    // Packs the options and value layouts into a single string. Every text is stored with its length,
+    // so labels and literals may contain any character
+    static FString EncodeLayout(const FDebugPrintOptionsLayout& InOptions, const TArray<FDebugPrintValueLayout>& InValues);
+
+    // Hash the node passes next to its layout, so a decoded node is found without reading the layout again
+    static int32 HashLayout(const FString& Layout);
+
+    // Returns the descriptor decoded from the layout with this hash at this bytecode address, or null when there is none
+    static const FDebugPrintNodeDescriptor* Find(const FGuid& NodeGuid, int32 LayoutHash, const uint8* LayoutCode);
+
+    // Returns the descriptor of the node at this bytecode address, decoding the layout only when it differs from the cached one
+    static const FDebugPrintNodeDescriptor& Get(const FGuid& NodeGuid, const FString& Layout, int32 LayoutHash = 0,
+        const uint8* LayoutCode = nullptr);
+
+    bool IsDynamic(EDynamicOption Option) const { return EnumHasAnyFlags(DynamicOptions, Option); }
+
+private:
+    // Layout the descriptor was decoded from, used to detect recompiled or duplicated nodes
+    FString SourceLayout;
+    int32 SourceLayoutHash = 0;
+
+    void Decode(const FString& Layout);
+};
+
+ENUM_CLASS_FLAGS(FDebugPrintNodeDescriptor::EDynamicOption);
@@ -3,10 +3,20 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "K2Node_DebugPrint.h"
+#include "DebugPrintTypes.h"
 #include "Engine/DeveloperSettings.h"
 #include "DebugPrintDeveloperSettings.generated.h"
 
+UENUM()
+enum class EDebugPrintStripPolicy : uint8
+{
+    Never UMETA(Tooltip = "DebugPrint nodes are always compiled."),
+    TestAndShipping UMETA(DisplayName = "Test and Shipping",
+        Tooltip = "Nodes are stripped when cooking with -DebugPrintStrip, or for Test or Shipping as set in the packaging settings. Command line and UAT cooks need -DebugPrintStrip."),
+    Cooked UMETA(Tooltip = "Nodes are stripped in every cook, but kept in the editor."),
+    Always UMETA(Tooltip = "Nodes are stripped everywhere, including Play In Editor.")
+};
+
 UCLASS(config = Game, defaultconfig, meta = (DisplayName = "Debug Print Plugin Settings"))
 class DEBUGPRINT_API UDebugPrintDeveloperSettings : public UDeveloperSettings
 {
@@ -28,4 +38,73 @@ public:
     /** Enum defining the print type */
     UPROPERTY(EditAnywhere, config, Category = "Default")
     TEnumAsByte<EPrintType> PrintType = EPrintType::PrintInColumns;
+
+    /** Maximum number of keyed entries on screen. Once reached, new keys replace the oldest entry */
+    UPROPERTY(EditAnywhere, config, Category = "Runtime", meta = (ClampMin = "0"))
+    int32 MaxDynamicKeys = 1024;
+
+    /** Maximum number of entries without a key on screen. Once reached, new entries replace the oldest one */
+    UPROPERTY(EditAnywhere, config, Category = "Runtime", meta = (ClampMin = "1"))
+    int32 MaxUnkeyedEntries = 256;
+
+    /** Number of messages native code on any thread can queue per frame. Messages beyond that are dropped */
+    UPROPERTY(EditAnywhere, config, Category = "Runtime", meta = (ClampMin = "16", ConfigRestartRequired = true))
+    int32 ThreadQueueSize = 1024;
+
+    /** Font of the on-screen overlay. A monospace font keeps values from shifting when their digits change */
+    UPROPERTY(EditAnywhere, config, Category = "Overlay", meta = (AllowedClasses = "/Script/Engine.Font"))
+    FSoftObjectPath OverlayFont = FSoftObjectPath(TEXT("/Engine/EngineFonts/DroidSansMono.DroidSansMono"));
+
+    /** Font size of the on-screen overlay */
+    UPROPERTY(EditAnywhere, config, Category = "Overlay", meta = (ClampMin = "4", ClampMax = "72"))
+    int32 OverlayFontSize = 10;
+
+    /** Top left corner of the overlay, relative to the safe zone */
+    UPROPERTY(EditAnywhere, config, Category = "Overlay")
+    FVector2D OverlayOrigin = FVector2D(48.f, 96.f);
+
+    /** Number of recent samples kept for every value printed as a graph */
+    UPROPERTY(EditAnywhere, config, Category = "Overlay", meta = (ClampMin = "2", ClampMax = "1024"))
+    int32 GraphHistorySize = 120;
+
+    /** Width of a graph on screen */
+    UPROPERTY(EditAnywhere, config, Category = "Overlay", meta = (ClampMin = "16", Units = "Pixels"))
+    float GraphWidth = 120.f;
+
+    /** Maximum number of elements shown for an Array, Set or Map. The remaining elements are only counted */
+    UPROPERTY(EditAnywhere, config, Category = "Containers", meta = (ClampMin = "1"))
+    int32 MaxContainerElements = 16;
+
+    /** Maximum number of characters shown for an Array, Set or Map. Elements past it are only counted */
+    UPROPERTY(EditAnywhere, config, Category = "Containers", meta = (ClampMin = "16"))
+    int32 MaxContainerLength = 512;
+
+    /** Maximum number of characters shown for a single element of an Array, Set or Map. Longer elements are cut off */
+    UPROPERTY(EditAnywhere, config, Category = "Containers", meta = (ClampMin = "8"))
+    int32 MaxContainerElementLength = 128;
+
+    /** Seconds each page of a container with more elements than shown stays on screen. 0 always shows the first elements */
+    UPROPERTY(EditAnywhere, config, Category = "Containers", meta = (ClampMin = "0", Units = "Seconds"))
+    float ContainerPageInterval = 0.f;
+
+    /** Number of recent samples averaged by Print Statistics next to the all-time aggregates */
+    UPROPERTY(EditAnywhere, config, Category = "Statistics", meta = (ClampMin = "1"))
+    int32 StatisticsWindowSize = 60;
+
+    /** Size of the buffer between the game thread and the recording thread. Records that don't fit are dropped */
+    UPROPERTY(EditAnywhere, config, Category = "Recording", meta = (ClampMin = "64", Units = "Kilobytes"))
+    int32 RecordingBufferSize = 8192;
+
+    /** When DebugPrint nodes are compiled to a plain exec wire, without evaluating their values */
+    UPROPERTY(EditAnywhere, config, Category = "Stripping")
+    EDebugPrintStripPolicy StripPolicy = EDebugPrintStripPolicy::TestAndShipping;
+
+    /** Nodes in one of these categories are kept even when stripping */
+    UPROPERTY(EditAnywhere, config, Category = "Stripping")
+    TArray<FName> KeptCategories;
+
+#if WITH_EDITOR
+    /** Whether a node in the given category is compiled to a plain exec wire */
+    bool ShouldStripNode(FName NodeCategory) const;
+#endif
 };
@@ -0,0 +1,76 @@
+// Copyright MoxAlehin. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DebugPrintFormatter.generated.h"
+
+// How numbers are written. Vectors, rotators and transforms apply it to every component
+USTRUCT()
+struct DEBUGPRINT_API FDebugPrintNumberFormat
+{
+    GENERATED_BODY()
+
+    // Digits after the decimal point. -1 keeps the default text of the type
+    UPROPERTY(EditAnywhere, Category = "Formatting", meta = (ClampMin = "-1", ClampMax = "15"))
+    int32 Precision = -1;
+
+    // Minimum number of characters of a number, padded with spaces so columns of numbers line up
+    UPROPERTY(EditAnywhere, Category = "Formatting", meta = (ClampMin = "0", ClampMax = "32"))
+    int32 MinWidth = 0;
+};
+
+// A value captured from the Blueprint frame, converted to text only when it is shown
+struct DEBUGPRINT_API FDebugPrintValue
+{
+    // Property and address of a typed value
+    const FProperty* Property = nullptr;
+    const void* Address = nullptr;
+
+    // Text known in advance, used instead of the typed value
+    const FString* Literal = nullptr;
+
+    // Format of the numbers in the value, the default format when null
+    const FDebugPrintNumberFormat* NumberFormat = nullptr;
+};
+
+// Converts captured values to text the same way the Blueprint ToString conversions do
+struct DEBUGPRINT_API FDebugPrintFormatter
+{
+    // Appends the text of the value to the output string
+    static void AppendValue(FString& Out, const FDebugPrintValue& Value);
+
+    // Hashes the value without formatting it, types without a hash function are hashed by their text
+    static uint32 HashValue(const FDebugPrintValue& Value);
+
+    // Reads the value as a number. Returns false for values that are neither numeric nor bool
+    static bool GetNumber(const FDebugPrintValue& Value, double& OutNumber);
+
+    // Whether structs of this type are formatted natively instead of through a user conversion function
+    static bool IsFormattedNatively(const UScriptStruct* Struct);
+
+    // Append numbers, vectors and rotators the way typed values of that kind are appended. Used for values that
+    // are no longer backed by a property, like the values of a capture
+    static void AppendDouble(FString& Out, double Value, const FDebugPrintNumberFormat& Format);
+    static void AppendInteger(FString& Out, int64 Value, const FDebugPrintNumberFormat& Format);
+    static void AppendVector(FString& Out, const FVector& Value, const FDebugPrintNumberFormat& Format);
+    static void AppendRotator(FString& Out, const FRotator& Value, const FDebugPrintNumberFormat& Format);
+};
+
+// Temporary string from a pool of the game thread, handed back when it goes out of scope. Pooled strings keep their
+// memory, so text formatted into them only allocates until the pool has seen the longest text of a frame
+class DEBUGPRINT_API FDebugPrintScratchString
+{
+public:
+    FDebugPrintScratchString();
+    ~FDebugPrintScratchString();
+
+    FDebugPrintScratchString(const FDebugPrintScratchString&) = delete;
+    FDebugPrintScratchString& operator=(const FDebugPrintScratchString&) = delete;
+
+    FString& operator*() const { return String; }
+    FString* operator->() const { return &String; }
+
+private:
+    FString& String;
+};
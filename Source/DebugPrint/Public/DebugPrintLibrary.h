@@ -0,0 +1,51 @@
+// Copyright MoxAlehin. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "DebugPrintTypes.h"
+#include "DebugPrintFormatter.h"
+#include "DebugPrintLibrary.generated.h"
+
+struct FDebugPrintNodeDescriptor;
+struct FDebugPrintStatistics;
+
+UCLASS()
+class DEBUGPRINT_API UDebugPrintLibrary : public UBlueprintFunctionLibrary
+{
+    GENERATED_BODY()
+
+public:
+    // Entry point of the DebugPrint node. Everything known at compile time is baked into the layout, the linked options
+    // and values follow as variadic arguments and are read straight from the frame, so they are only converted to text
+    // when the message is actually shown
+    UFUNCTION(BlueprintCallable, CustomThunk, Category = "Debug",
+        meta = (Variadic, BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject", CallableWithoutWorldContext))
+    static void DebugPrint(const UObject* WorldContextObject, const FGuid& NodeGuid, int32 LayoutHash, const FString& Layout);
+    DECLARE_FUNCTION(execDebugPrint);
+
+    // Gate in front of every DebugPrint node, false when printing or the category of the node is switched off
+    // with DebugPrint.Enable or DebugPrint.Filter. The node branches on the result before its values are evaluated
+    UFUNCTION(BlueprintPure, Category = "Debug", meta = (BlueprintInternalUseOnly = "true"))
+    static bool IsCategoryEnabled(FName Category);
+
+    // Gate of a throttled DebugPrint node, evaluated per node and object. The node branches on the result
+    // before its values are evaluated
+    UFUNCTION(BlueprintCallable, Category = "Debug",
+        meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject", CallableWithoutWorldContext))
+    static bool ShouldPrint(const UObject* WorldContextObject, const FGuid& NodeGuid, float MaxUpdateRate, int32 PrintEveryNth,
+        float SampleChance);
+
+    // Prints captured values in the layout of the node
+    static void PrintValues(const UObject* WorldContextObject, TConstArrayView<FDebugPrintValue> Values,
+        const FDebugPrintNodeDescriptor& Descriptor, FName Key, const FString& Separator, bool bSeparatorInLayout,
+        FLinearColor TextColor, float Duration, EPrintType Type);
+
+    // Starts the statistics of every node, label and object over
+    static void ResetStatistics();
+
+    // Calls the callback with the statistics of every value printed with PrintStatistics
+    static void ForEachStatistics(
+        TFunctionRef<void(const FGuid& NodeGuid, const UObject* Object, const FString& Label, const FDebugPrintStatistics& Statistics)> Callback);
+};
@@ -0,0 +1,86 @@
+// Copyright MoxAlehin. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include <atomic>
+
+// Message printed from native code, stored inline so queuing it never allocates
+struct FDebugPrintMessage
+{
+    static constexpr int32 MaxLabelLength = 64;
+    static constexpr int32 MaxValueLength = 192;
+
+    FName Key;
+    uint32 ThreadId = 0;
+    FLinearColor Color = FLinearColor::White;
+    float Duration = 0.f;
+    int32 LabelLength = 0;
+    int32 ValueLength = 0;
+    TCHAR Label[MaxLabelLength];
+    TCHAR Value[MaxValueLength];
+};
+
+// Lets native code print from any thread. Producers claim a slot of a preallocated ring with a single
+// compare-and-swap and copy their message into it, the game thread moves the messages to the overlay once per frame.
+// Keys are local to the thread that printed them, so workers using the same key don't overwrite each other.
+class DEBUGPRINT_API FDebugPrintQueue
+{
+public:
+    static FDebugPrintQueue& Get();
+
+    // Allocates the ring and starts draining it every frame
+    void Initialize();
+    void Shutdown();
+
+    // Queues a message, truncating longer texts. Returns false when the queue is full or not initialized
+    bool Enqueue(FName Key, FStringView Label, FStringView Value, FLinearColor Color, float Duration);
+
+    // Moves all queued messages to the overlay. Game thread only
+    void Drain();
+
+    // Messages dropped because the queue was full
+    uint32 GetNumDropped() const { return NumDropped.load(std::memory_order_relaxed); }
+
+private:
+    struct FSlot
+    {
+        // Equals the position of the slot when it's free to write, the position + 1 once the message is ready
+        std::atomic<uint64> Sequence{0};
+        FDebugPrintMessage Message;
+    };
+
+    bool Tick(float DeltaTime);
+
+    std::atomic<FSlot*> Slots{nullptr};
+    uint64 Mask = 0;
+    std::atomic<uint64> EnqueuePosition{0};
+    uint64 DequeuePosition = 0;
+    std::atomic<uint32> NumDropped{0};
+    bool bReportedDropped = false;
+
+    FTSTicker::FDelegateHandle TickHandle;
+};
+
+namespace DebugPrint
+{
+    // Prints a line with the value under the label. Safe to call from any thread
+    inline void Print(FName Key, FStringView Label, FStringView Value,
+        FLinearColor Color = FLinearColor::White, float Duration = 2.f)
+    {
+        FDebugPrintQueue::Get().Enqueue(Key, Label, Value, Color, Duration);
+    }
+
+    // Formats the number on the stack and prints it. Safe to call from any thread
+    DEBUGPRINT_API void Print(FName Key, FStringView Label, double Value,
+        FLinearColor Color = FLinearColor::White, float Duration = 2.f);
+    DEBUGPRINT_API void Print(FName Key, FStringView Label, int64 Value,
+        FLinearColor Color = FLinearColor::White, float Duration = 2.f);
+
+    inline void Print(FName Key, FStringView Label, int32 Value,
+        FLinearColor Color = FLinearColor::White, float Duration = 2.f)
+    {
+        Print(Key, Label, int64(Value), Color, Duration);
+    }
+}
@@ -0,0 +1,116 @@
+// Copyright MoxAlehin. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "DebugPrintFormatter.h"
+#include <atomic>
+
+class FArchive;
+class FEvent;
+class FRunnableThread;
+struct FDebugPrintNodeDescriptor;
+
+// Binary layout of a DebugPrint capture file. All numbers are little endian.
+//
+// File:   Magic, Version, then chunks until the end of the file
+// Chunk:  uint32 UncompressedSize, uint32 CompressedSize, uint64 FirstFrame, uint64 LastFrame, zlib compressed records.
+//         Records are stored uncompressed when both sizes are equal
+// Record: uint32 Size (including this header), uint8 ERecordType, FGuid NodeGuid, uint64 Frame, double Time, payload
+//         Node payload:   uint8 PrintType, uint8 ENodeFlags, Separator, uint16 NumValues, then for every value
+//                         Label, LabelPrefix, int8 Precision, uint8 MinWidth. Version 1 stored only NumLabels and labels
+//         Values payload: uint16 NumValues, every value is a uint8 EValueType followed by its data
+// String: uint16 Length, UTF-8 bytes
+namespace DebugPrintCapture
+{
+    constexpr uint32 Magic = 0x43525044;  // "DPRC"
+    constexpr uint32 Version = 2;
+
+    constexpr int32 ChunkHeaderSize = sizeof(uint32) * 2 + sizeof(uint64) * 2;
+    constexpr int32 RecordHeaderSize = sizeof(uint32) + sizeof(uint8) + sizeof(FGuid) + sizeof(uint64) + sizeof(double);
+
+    enum class ERecordType : uint8
+    {
+        Node,
+        Values
+    };
+
+    enum class ENodeFlags : uint8
+    {
+        None = 0,
+        SeparatorInLayout = 1 << 0
+    };
+    ENUM_CLASS_FLAGS(ENodeFlags)
+
+    enum class EValueType : uint8
+    {
+        String,
+        Bool,
+        Int,
+        Double,
+        Vector,
+        Rotator
+    };
+}
+
+// Records the values of every DebugPrint call into a capture file. The game thread only serializes a compact record
+// into a lock-free ring buffer; a background thread compresses the records and writes them to disk.
+class DEBUGPRINT_API FDebugPrintRecorder : public FRunnable
+{
+public:
+    static FDebugPrintRecorder& Get();
+
+    // Starts a new capture in Saved/DebugPrint. Returns false when the file can't be created
+    bool Start(const FString& SessionName = FString());
+    void Stop();
+
+    bool IsRecording() const { return bRecording.load(std::memory_order_relaxed); }
+
+    // Adds a record of the values. Never blocks: records that don't fit into the ring buffer are dropped and counted
+    void Record(const FGuid& NodeGuid, const FDebugPrintNodeDescriptor& Descriptor, TConstArrayView<FDebugPrintValue> Values);
+
+    // FRunnable interface
+    virtual uint32 Run() override;
+    // End of FRunnable interface
+
+private:
+    // Single producer, single consumer byte ring. Records are pushed and popped whole
+    class FRing
+    {
+    public:
+        void Init(uint32 Capacity);
+        bool Push(const uint8* Data, uint32 Size);
+
+        // Appends complete records to Out until MaxBytes would be exceeded
+        void Pop(TArray<uint8>& Out, uint32 MaxBytes);
+
+    private:
+        void Copy(uint64 Position, uint8* Dest, uint32 Size) const;
+
+        TArray<uint8> Buffer;
+        uint64 Mask = 0;
+        std::atomic<uint64> WriteIndex{0};
+        std::atomic<uint64> ReadIndex{0};
+    };
+
+    // Compresses the pending records and writes them as chunks, returns false when there was nothing to write
+    bool Flush();
+
+    FRing Ring;
+    std::atomic<bool> bRecording{false};
+    std::atomic<bool> bStopping{false};
+    std::atomic<uint32> NumDroppedRecords{0};
+
+    FRunnableThread* Thread = nullptr;
+    FEvent* WakeEvent = nullptr;
+    FArchive* Writer = nullptr;
+    double StartTime = 0.0;
+
+    // Nodes whose layout was already written in this capture. Game thread only
+    TSet<FGuid> RecordedNodes;
+
+    // Buffers of the writer thread
+    TArray<uint8> PendingRecords;
+    TArray<uint8> CompressedRecords;
+};
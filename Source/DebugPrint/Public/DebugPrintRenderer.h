@@ -0,0 +1,146 @@
+// Copyright MoxAlehin. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Fonts/SlateFontInfo.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/StrongObjectPtr.h"
+#include "DebugPrintStatistics.h"
+
+class UCanvas;
+class APlayerController;
+class FShapedGlyphSequence;
+
+// Ring buffer of the recent samples of a graphed value. Its storage is allocated once, adding samples never allocates
+struct DEBUGPRINT_API FDebugPrintHistory
+{
+    // Sets the number of kept samples, dropping the old ones only when it changes
+    void SetCapacity(int32 Capacity);
+    void Add(float Sample);
+    void Reset();
+
+    int32 Num() const { return NumSamples; }
+    bool IsEmpty() const { return NumSamples == 0; }
+
+    // Samples from the oldest to the newest
+    float operator[](int32 Index) const { return Samples[(NextSample - NumSamples + Index + Samples.Num()) % Samples.Num()]; }
+
+    float GetMin() const { return Min; }
+    float GetMax() const { return Max; }
+
+private:
+    TArray<float> Samples;
+    int32 NextSample = 0;
+    int32 NumSamples = 0;
+    float Min = 0.f;
+    float Max = 0.f;
+};
+
+// A single line of an entry. Label is drawn in its own column when the entry aligns columns
+struct FDebugPrintCell
+{
+    FString Label;
+    FString Value;
+
+    // Glyph runs of the label and value, reused by the overlay while their text and the font stay the same
+    TSharedPtr<const FShapedGlyphSequence> ShapedLabel;
+    TSharedPtr<const FShapedGlyphSequence> ShapedValue;
+    FString ShapedLabelText;
+    FString ShapedValueText;
+
+    // Samples drawn as a graph between the label and the value, null for lines without a graph. The history belongs
+    // to the node that printed the line, so it keeps its samples when the line expires
+    TSharedPtr<const FDebugPrintHistory> History;
+
+    // Hash of the value the text was formatted from, 0 when unknown
+    uint32 ValueHash = 0;
+};
+
+// Everything a node printed under one key, drawn as a block of lines
+struct FDebugPrintEntry
+{
+    FName Key;
+
+    // Keys are unique within a namespace. Blueprint output uses namespace 0, queued output the id of its thread
+    uint32 KeyNamespace = 0;
+
+    TArray<FDebugPrintCell> Cells;
+    bool bAlignColumns = false;
+    FLinearColor Color = FLinearColor::White;
+    double ExpireTime = 0.0;
+    bool bDrawn = false;
+
+    // Zero duration entries stay until drawn once, as long as their world draws at all
+    bool bDrawOnce = false;
+    TWeakObjectPtr<const UWorld> World;
+
+    // Object that printed the entry and the GUID of its node. Both are unset for native prints
+    TWeakObjectPtr<const UObject> Owner;
+    FGuid NodeGuid;
+
+    // Width of the label column, measured again only when a label changes
+    float LabelWidth = 0.f;
+
+    // Hash of all values shown by the entry, 0 when unknown
+    uint32 ContentHash = 0;
+};
+
+// Collects the output of all DebugPrint nodes and draws it once per frame as an overlay on the debug canvas,
+// using its own font instead of the engine's Small Font. Entries with a key are updated in place, entries without
+// a key are added as new lines like Print String does.
+class DEBUGPRINT_API FDebugPrintRenderer
+{
+public:
+    static FDebugPrintRenderer& Get();
+
+    void Register();
+    void Unregister();
+
+    // Returns the entry to fill for the key. Cells keep their strings between frames, so refilling them reuses memory
+    FDebugPrintEntry& AddEntry(FName Key, const UObject* WorldContextObject, FLinearColor Color, float Duration,
+        uint32 KeyNamespace = 0);
+
+    // Returns the entry shown for the key, or null when there is none
+    FDebugPrintEntry* FindEntry(FName Key, uint32 KeyNamespace = 0);
+
+    int32 GetNumKeys() const { return KeyToIndex.Num(); }
+
+    // Removes every entry at once
+    void Clear();
+
+    void ForEachEntry(TFunctionRef<void(FDebugPrintEntry&)> Callback);
+
+private:
+    void Draw(UCanvas* Canvas, APlayerController* PlayerController);
+    void RemoveExpiredEntries(double Now);
+
+    void RebuildKeyToIndex();
+
+    // Returns whether a canvas showing the world was drawn this frame or the one before
+    bool IsWorldDrawing(const UWorld* World) const;
+
+    // Loads the overlay font from the settings, returns true when it differs from the one used so far
+    bool UpdateFont();
+
+    // Shapes the text again only when it changed or the font cache was flushed. Returns true when it was reshaped
+    bool ShapeText(const FString& Text, FString& ShapedText, TSharedPtr<const FShapedGlyphSequence>& ShapedSequence) const;
+
+    // Entries in the order they were first printed
+    TArray<FDebugPrintEntry> Entries;
+
+    // Index of every keyed entry in Entries
+    TMap<TPair<FName, uint32>, int32> KeyToIndex;
+
+    // Frame each world was last drawn in. Canvases without a world are stored under the null key
+    TMap<FObjectKey, uint64> WorldDrawFrames;
+
+    // Frame the expired entries were last removed in
+    uint64 LastExpireFrame = 0;
+
+    FDelegateHandle DrawHandle;
+
+    FSlateFontInfo FontInfo;
+    FSoftObjectPath LoadedFontPath;
+    TStrongObjectPtr<UObject> LoadedFont;
+};
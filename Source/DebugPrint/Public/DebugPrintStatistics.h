@@ -0,0 +1,44 @@
+// Copyright MoxAlehin. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Running statistics of a value, updated in constant time per sample. The rolling window is allocated once,
+// adding samples never allocates
+struct DEBUGPRINT_API FDebugPrintStatistics
+{
+    // Sets the number of samples in the rolling window, dropping the window only when it changes
+    void SetWindowSize(int32 WindowSize);
+    void Add(double Sample);
+    void Reset();
+
+    bool IsEmpty() const { return Count == 0; }
+    int64 GetCount() const { return Count; }
+    double GetMin() const { return Min; }
+    double GetMax() const { return Max; }
+    double GetMean() const { return Mean; }
+    double GetVariance() const { return Count > 1 ? SquaredDeviations / double(Count - 1) : 0.0; }
+    double GetStdDev() const { return FMath::Sqrt(GetVariance()); }
+
+    // Mean of the last samples, up to the window size
+    double GetWindowMean() const { return NumWindowSamples > 0 ? WindowSum / NumWindowSamples : 0.0; }
+    int32 GetWindowNum() const { return NumWindowSamples; }
+
+    // Appends the aggregates as shown on screen
+    void AppendSummary(FString& Out) const;
+
+private:
+    int64 Count = 0;
+    double Min = 0.0;
+    double Max = 0.0;
+    double Mean = 0.0;
+
+    // Sum of squared deviations from the mean, kept with Welford's method
+    double SquaredDeviations = 0.0;
+
+    TArray<double> Window;
+    int32 NextSample = 0;
+    int32 NumWindowSamples = 0;
+    double WindowSum = 0.0;
+};
@@ -0,0 +1,41 @@
+// Copyright MoxAlehin. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+// Cost of the plugin itself, shown with "stat DebugPrint" and traced to Unreal Insights with -trace=DebugPrint
+DECLARE_STATS_GROUP(TEXT("DebugPrint"), STATGROUP_DebugPrint, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Print Call"), STAT_DebugPrint_Call, STATGROUP_DebugPrint, DEBUGPRINT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Format"), STAT_DebugPrint_Format, STATGROUP_DebugPrint, DEBUGPRINT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Submit"), STAT_DebugPrint_Submit, STATGROUP_DebugPrint, DEBUGPRINT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Record"), STAT_DebugPrint_Record, STATGROUP_DebugPrint, DEBUGPRINT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Drain Queue"), STAT_DebugPrint_Drain, STATGROUP_DebugPrint, DEBUGPRINT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Draw"), STAT_DebugPrint_Draw, STATGROUP_DebugPrint, DEBUGPRINT_API);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Messages"), STAT_DebugPrint_Messages, STATGROUP_DebugPrint, DEBUGPRINT_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Values"), STAT_DebugPrint_Values, STATGROUP_DebugPrint, DEBUGPRINT_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Bytes Formatted"), STAT_DebugPrint_BytesFormatted, STATGROUP_DebugPrint, DEBUGPRINT_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Live Keys"), STAT_DebugPrint_LiveKeys, STATGROUP_DebugPrint, DEBUGPRINT_API);
+
+UE_TRACE_CHANNEL_EXTERN(DebugPrintChannel, DEBUGPRINT_API);
+
+// Times the rest of the scope as a cycle stat and as an Insights event on the DebugPrint channel
+#define DEBUGPRINT_SCOPE_CYCLE_COUNTER(Stat) \
+    SCOPE_CYCLE_COUNTER(Stat); \
+    TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Stat, DebugPrintChannel)
+
+namespace DebugPrintStats
+{
+    // Counts a message submitted to the overlay. Game thread only
+    DEBUGPRINT_API void CountMessage(int32 NumValues, int32 NumBytesFormatted);
+
+    // Publishes the counters to Insights at the end of every frame
+    void Register();
+    void Unregister();
+}
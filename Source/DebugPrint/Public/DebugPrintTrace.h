@@ -0,0 +1,24 @@
+// Copyright MoxAlehin. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DebugPrintStats.h"
+
+struct FDebugPrintNodeDescriptor;
+struct FDebugPrintValue;
+
+// Streams the printed values to Unreal Insights on the DebugPrint channel, with -trace=default,DebugPrint.
+// Numbers are sent as DebugPrint.NumberValue events and as counters under DebugPrint/, everything else as
+// DebugPrint.TextValue events holding the text the overlay shows. Both carry the node GUID and the label.
+namespace DebugPrintTrace
+{
+    inline bool IsEnabled()
+    {
+        return UE_TRACE_CHANNELEXPR_IS_ENABLED(DebugPrintChannel);
+    }
+
+    // Emits an event per value. Only call it when IsEnabled() returns true
+    DEBUGPRINT_API void TraceValues(const FGuid& NodeGuid, const FDebugPrintNodeDescriptor& Descriptor,
+        TConstArrayView<FDebugPrintValue> Values);
+}
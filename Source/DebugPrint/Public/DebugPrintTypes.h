@@ -0,0 +1,21 @@
+// Copyright MoxAlehin. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DebugPrintTypes.generated.h"
+
+UENUM(BlueprintType)
+enum EPrintType : uint8
+{
+    PrintInColumns UMETA(DisplayName = "Print In Columns", Tooltip = "Prints each value in columns, aligning labels and keys."),
+    PrintLabels UMETA(DisplayName = "Print With Labels", Tooltip = "Prints each value with a label."),
+    PrintNewLine UMETA(DisplayName = "Print With New Lines", Tooltip = "Prints each value on a new line."),
+    PrintReplace UMETA(DisplayName = "Print and Replace",
+        Tooltip = "Prints in one line but overwrites the content each time, even without overriding the key."),
+    PrintInline UMETA(DisplayName = "Print Inline", Tooltip = "Prints all content in one line like a standard print string."),
+    PrintGraph UMETA(DisplayName = "Print Graph",
+        Tooltip = "Prints each numeric value as a graph of its recent history with its minimum, maximum and current value."),
+    PrintStatistics UMETA(DisplayName = "Print Statistics",
+        Tooltip = "Prints running statistics of each numeric value: count, mean, deviation, minimum, maximum and recent mean.")
+};
@@ -0,0 +1,59 @@
+// Copyright MoxAlehin. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+// A line shown by the overlay, as seen by tools watching the output
+struct FDebugPrintWatchRow
+{
+    // Node that printed the line. Invalid for native prints
+    FGuid NodeGuid;
+
+    // Class of the printing object without its _C suffix, and the name of the object
+    FString Blueprint;
+    FString Instance;
+
+    FString Label;
+    FString Value;
+    FLinearColor Color = FLinearColor::White;
+};
+
+// Every line on screen at the end of a frame
+struct FDebugPrintWatchSnapshot
+{
+    uint64 Frame = 0;
+    TArray<FDebugPrintWatchRow> Rows;
+};
+
+// Publishes the overlay content once per frame for editor tools. The game thread fills the back snapshot while readers
+// keep the front one, and publishing only swaps the two under a short lock, so a slow reader never holds up a frame.
+// Nothing is copied while no one is watching.
+class DEBUGPRINT_API FDebugPrintWatch
+{
+public:
+    static FDebugPrintWatch& Get();
+
+    void Register();
+    void Unregister();
+
+    // Watchers keep the snapshots coming, and keep nodes formatting while screen messages are disabled
+    void AddWatcher() { NumWatchers.fetch_add(1, std::memory_order_relaxed); }
+    void RemoveWatcher() { NumWatchers.fetch_sub(1, std::memory_order_relaxed); }
+    bool IsWatched() const { return NumWatchers.load(std::memory_order_relaxed) > 0; }
+
+    // Latest published snapshot, null until the first frame is published. Safe to call from any thread
+    TSharedPtr<const FDebugPrintWatchSnapshot, ESPMode::ThreadSafe> GetSnapshot() const;
+
+private:
+    void Publish();
+
+    std::atomic<int32> NumWatchers{0};
+
+    mutable FCriticalSection SnapshotMutex;
+    TSharedPtr<FDebugPrintWatchSnapshot, ESPMode::ThreadSafe> FrontSnapshot;
+    TSharedPtr<FDebugPrintWatchSnapshot, ESPMode::ThreadSafe> BackSnapshot;
+
+    FDelegateHandle EndFrameHandle;
+};
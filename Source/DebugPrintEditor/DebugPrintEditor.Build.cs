@@ -0,0 +1,33 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+using UnrealBuildTool;
+
+public class DebugPrintEditor : ModuleRules
+{
+	public DebugPrintEditor(ReadOnlyTargetRules target) : base(target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+		
+		PublicDependencyModuleNames.AddRange(new string[]
+		{
+			"Core",
+			"CoreUObject",
+			"Engine",
+			"BlueprintGraph",
+			"DebugPrint"
+		});
+	
+		PrivateDependencyModuleNames.AddRange(new string[]
+		{
+			"Slate",
+			"SlateCore",
+			"KismetCompiler",
+			"GraphEditor",
+			"UnrealEd",
+			"ToolMenus",
+			"WorkspaceMenuStructure",
+			"DeveloperSettings",
+			"Json"
+		});
+	}
+}
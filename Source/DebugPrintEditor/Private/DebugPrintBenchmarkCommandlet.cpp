@@ -0,0 +1,335 @@
+// Copyright MoxAlehin. All Rights Reserved.
+
+#include "DebugPrintBenchmarkCommandlet.h"
+
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Policies/PrettyJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+#include "DebugPrint.h"
+#include "DebugPrintDescriptor.h"
+#include "DebugPrintLibrary.h"
+#include "DebugPrintRenderer.h"
+
+namespace DebugPrintBenchmark
+{
+    const int32 ValueCounts[] = {1, 2, 4, 8, 16, 32, 64};
+
+    const TCHAR* ShortLabel = TEXT("X");
+    const TCHAR* LongLabel = TEXT("Character Movement Component Velocity Magnitude");
+
+    constexpr int32 WarmupIterations = 100;
+
+    // Counts the heap allocations made by the benchmark thread, forwarding everything to the real allocator
+    class FCountingMalloc final : public FMalloc
+    {
+    public:
+        explicit FCountingMalloc(FMalloc* InInner)
+            : Inner(InInner), ThreadId(FPlatformTLS::GetCurrentThreadId())
+        {
+        }
+
+        uint64 NumAllocations = 0;
+        uint64 NumBytes = 0;
+
+        virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+        {
+            Track(Count);
+            return Inner->Malloc(Count, Alignment);
+        }
+
+        virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+        {
+            Track(Count);
+            return Inner->Realloc(Original, Count, Alignment);
+        }
+
+        virtual void Free(void* Original) override { Inner->Free(Original); }
+        virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+        virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+        virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+        virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+        virtual const TCHAR* GetDescriptiveName() override { return TEXT("DebugPrintBenchmark"); }
+
+    private:
+        void Track(SIZE_T Count)
+        {
+            if (Count > 0 && FPlatformTLS::GetCurrentThreadId() == ThreadId)
+            {
+                NumAllocations++;
+                NumBytes += Count;
+            }
+        }
+
+        FMalloc* Inner;
+        uint32 ThreadId;
+    };
+
+    // Encodes the layout the way ExpandNode does and checks that decoding it gives back every option and value.
+    // A layout that doesn't decode makes the thunk step over the wrong number of arguments, so nothing is timed then
+    bool CheckLayoutRoundTrip(const FDebugPrintOptionsLayout& Options, const TArray<FDebugPrintValueLayout>& Layouts)
+    {
+        const FString Layout = FDebugPrintNodeDescriptor::EncodeLayout(Options, Layouts);
+        const FDebugPrintNodeDescriptor& Descriptor = FDebugPrintNodeDescriptor::Get(FGuid::NewGuid(), Layout);
+
+        bool bMatches = Descriptor.bSeparatorInLayout == Options.bSeparatorInLayout &&
+            Descriptor.bPrintOnChange == Options.bPrintOnChange &&
+            Descriptor.IsDynamic(FDebugPrintNodeDescriptor::EDynamicOption::Key) == !Options.Key.IsSet() &&
+            Descriptor.IsDynamic(FDebugPrintNodeDescriptor::EDynamicOption::Separator) == !Options.Separator.IsSet() &&
+            Descriptor.IsDynamic(FDebugPrintNodeDescriptor::EDynamicOption::TextColor) == !Options.TextColor.IsSet() &&
+            Descriptor.IsDynamic(FDebugPrintNodeDescriptor::EDynamicOption::Duration) == !Options.Duration.IsSet() &&
+            Descriptor.IsDynamic(FDebugPrintNodeDescriptor::EDynamicOption::PrintType) == !Options.PrintType.IsSet();
+        bMatches &= !Options.Key.IsSet() || Descriptor.Key == FName(*Options.Key.GetValue());
+        bMatches &= !Options.Separator.IsSet() || Descriptor.Separator.Equals(Options.Separator.GetValue(), ESearchCase::CaseSensitive);
+        bMatches &= !Options.Duration.IsSet() || Descriptor.Duration == FCString::Atof(*Options.Duration.GetValue());
+        bMatches &= !Options.PrintType.IsSet() || Descriptor.PrintType == FCString::Atoi(*Options.PrintType.GetValue());
+
+        bMatches &= Descriptor.Values.Num() == Layouts.Num();
+        for (int32 Index = 0; bMatches && Index < Layouts.Num(); ++Index)
+        {
+            const FDebugPrintValueLayout& Expected = Layouts[Index];
+            const FDebugPrintValueLayout& Decoded = Descriptor.Values[Index];
+            bMatches &= Decoded.Label.Equals(Expected.Label, ESearchCase::CaseSensitive) &&
+                Decoded.LabelPrefix.Equals(Expected.LabelPrefix, ESearchCase::CaseSensitive) &&
+                Decoded.NumberFormat.Precision == Expected.NumberFormat.Precision &&
+                Decoded.NumberFormat.MinWidth == Expected.NumberFormat.MinWidth &&
+                Decoded.Literal.IsSet() == Expected.Literal.IsSet() &&
+                (!Expected.Literal.IsSet() || Decoded.Literal.GetValue().Equals(Expected.Literal.GetValue(), ESearchCase::CaseSensitive));
+        }
+
+        if (!bMatches)
+        {
+            UE_LOG(LogDebugPrint, Error, TEXT("Layout %s doesn't decode to the options and values it was encoded from"), *Layout);
+        }
+        return bMatches;
+    }
+
+    // Options as ExpandNode bakes them for a node whose option pins aren't linked
+    FDebugPrintOptionsLayout MakeBakedOptions(const FString& Key, const FString& Separator, EPrintType Type)
+    {
+        FDebugPrintOptionsLayout Options;
+        Options.Key = Key;
+        Options.Separator = Separator;
+        Options.TextColor = FLinearColor::White.ToString();
+        Options.Duration = TEXT("0.0");
+        Options.PrintType = FString::FromInt(int32(Type));
+        return Options;
+    }
+
+    struct FResult
+    {
+        FString PrintType;
+        int32 NumValues = 0;
+        bool bLongLabels = false;
+        double NanosecondsPerCall = 0.0;
+        double AllocationsPerCall = 0.0;
+        double BytesPerCall = 0.0;
+    };
+}
+
+UDebugPrintBenchmarkCommandlet::UDebugPrintBenchmarkCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = false;
+    LogToConsole = true;
+}
+
+int32 UDebugPrintBenchmarkCommandlet::Main(const FString& Params)
+{
+    using namespace DebugPrintBenchmark;
+
+    int32 Iterations = 1000;
+    FParse::Value(*Params, TEXT("Iterations="), Iterations);
+    Iterations = FMath::Max(Iterations, 1);
+
+    FString OutputPath = FPaths::ProjectSavedDir() / TEXT("DebugPrint") / TEXT("Benchmark.json");
+    FParse::Value(*Params, TEXT("Output="), OutputPath);
+
+    // Lets nightly runs fail as soon as steady state printing allocates again
+    const bool bFailOnAllocations = FParse::Param(*Params, TEXT("FailOnAllocations"));
+
+    // Every value type the formatter handles differently, repeated to fill the node
+    const FProperty* Properties[] = {
+        FindFProperty<FProperty>(GetClass(), GET_MEMBER_NAME_CHECKED(UDebugPrintBenchmarkCommandlet, FloatValue)),
+        FindFProperty<FProperty>(GetClass(), GET_MEMBER_NAME_CHECKED(UDebugPrintBenchmarkCommandlet, IntValue)),
+        FindFProperty<FProperty>(GetClass(), GET_MEMBER_NAME_CHECKED(UDebugPrintBenchmarkCommandlet, bBoolValue)),
+        FindFProperty<FProperty>(GetClass(), GET_MEMBER_NAME_CHECKED(UDebugPrintBenchmarkCommandlet, VectorValue)),
+        FindFProperty<FProperty>(GetClass(), GET_MEMBER_NAME_CHECKED(UDebugPrintBenchmarkCommandlet, StringValue)),
+        FindFProperty<FProperty>(GetClass(), GET_MEMBER_NAME_CHECKED(UDebugPrintBenchmarkCommandlet, EnumValue)),
+        FindFProperty<FProperty>(GetClass(), GET_MEMBER_NAME_CHECKED(UDebugPrintBenchmarkCommandlet, NameValue)),
+        FindFProperty<FProperty>(GetClass(), GET_MEMBER_NAME_CHECKED(UDebugPrintBenchmarkCommandlet, TextValue)),
+        FindFProperty<FProperty>(GetClass(), GET_MEMBER_NAME_CHECKED(UDebugPrintBenchmarkCommandlet, ArrayValue)),
+        FindFProperty<FProperty>(GetClass(), GET_MEMBER_NAME_CHECKED(UDebugPrintBenchmarkCommandlet, StructValue))
+    };
+
+    const UEnum* PrintTypeEnum = StaticEnum<EPrintType>();
+    const FString Key(TEXT("DebugPrintBenchmark"));
+    const FString Separator(TEXT(" | "));
+
+    // Layouts must decode before anything is timed: the default unlinked Key, a set Key, both flags, literals and
+    // linked options
+    {
+        TArray<FDebugPrintValueLayout> Layouts;
+        FDebugPrintValueLayout& Linked = Layouts.AddDefaulted_GetRef();
+        Linked.Label = TEXT("Speed");
+        Linked.LabelPrefix = TEXT("Speed | ");
+        Linked.NumberFormat.Precision = 2;
+        Linked.NumberFormat.MinWidth = 8;
+        FDebugPrintValueLayout& Literal = Layouts.AddDefaulted_GetRef();
+        Literal.Label = TEXT("Name:*,1");
+        Literal.Literal = TEXT("12:Literal*");
+
+        FDebugPrintOptionsLayout WithFlags = MakeBakedOptions(Key, Separator, EPrintType::PrintStatistics);
+        WithFlags.bSeparatorInLayout = true;
+        WithFlags.bPrintOnChange = true;
+
+        const bool bRoundTrips =
+            CheckLayoutRoundTrip(MakeBakedOptions(TEXT("None"), Separator, EPrintType::PrintInColumns), Layouts) &&
+            CheckLayoutRoundTrip(WithFlags, Layouts) &&
+            CheckLayoutRoundTrip(FDebugPrintOptionsLayout(), Layouts);
+        if (!bRoundTrips)
+        {
+            return 1;
+        }
+    }
+
+    TArray<FResult> Results;
+    for (int32 TypeIndex = 0; TypeIndex < PrintTypeEnum->NumEnums() - 1; ++TypeIndex)
+    {
+        const EPrintType Type = EPrintType(PrintTypeEnum->GetValueByIndex(TypeIndex));
+        for (const int32 NumValues : ValueCounts)
+        {
+            for (const bool bLongLabels : {false, true})
+            {
+                // Every value pin is linked, so every value goes through the formatter
+                TArray<FDebugPrintValueLayout> Layouts;
+                TArray<FDebugPrintValue> Values;
+                for (int32 Index = 0; Index < NumValues; ++Index)
+                {
+                    FDebugPrintValueLayout& Layout = Layouts.AddDefaulted_GetRef();
+                    Layout.Label = FString::Printf(TEXT("%s %d"), bLongLabels ? LongLabel : ShortLabel, Index);
+                    Layout.LabelPrefix = Layout.Label + Separator;
+
+                    FDebugPrintValue& Value = Values.AddDefaulted_GetRef();
+                    Value.Property = Properties[Index % UE_ARRAY_COUNT(Properties)];
+                    Value.Address = Value.Property->ContainerPtrToValuePtr<void>(this);
+                }
+
+                // Options are baked like on a node whose option pins aren't linked
+                const FDebugPrintOptionsLayout Options = MakeBakedOptions(Key, Separator, Type);
+                if (!CheckLayoutRoundTrip(Options, Layouts))
+                {
+                    return 1;
+                }
+
+                // Every call looks its node up like execDebugPrint does. The layout string stands in for the bytecode
+                // address of the layout literal
+                const FGuid NodeGuid = FGuid::NewGuid();
+                const FString Layout = FDebugPrintNodeDescriptor::EncodeLayout(Options, Layouts);
+                const int32 LayoutHash = FDebugPrintNodeDescriptor::HashLayout(Layout);
+                const uint8* LayoutCode = reinterpret_cast<const uint8*>(*Layout);
+                const FDebugPrintNodeDescriptor& Descriptor = FDebugPrintNodeDescriptor::Get(NodeGuid, Layout, LayoutHash, LayoutCode);
+                for (int32 Index = 0; Index < NumValues; ++Index)
+                {
+                    Values[Index].NumberFormat = &Descriptor.Values[Index].NumberFormat;
+                }
+
+                auto Print = [&]()
+                {
+                    FloatValue += 1.f;
+                    const FDebugPrintNodeDescriptor* Found = FDebugPrintNodeDescriptor::Find(NodeGuid, LayoutHash, LayoutCode);
+                    if (!Found)
+                    {
+                        Found = &FDebugPrintNodeDescriptor::Get(NodeGuid, Layout, LayoutHash, LayoutCode);
+                    }
+                    UDebugPrintLibrary::PrintValues(nullptr, Values, *Found, Found->Key, Found->Separator,
+                        Found->bSeparatorInLayout, Found->TextColor, Found->Duration, EPrintType(Found->PrintType));
+                };
+
+                for (int32 Iteration = 0; Iteration < WarmupIterations; ++Iteration)
+                {
+                    Print();
+                }
+
+                const uint64 StartCycles = FPlatformTime::Cycles64();
+                for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+                {
+                    Print();
+                }
+                const uint64 Cycles = FPlatformTime::Cycles64() - StartCycles;
+
+                // Allocations are counted in a separate pass, so the counting doesn't show up in the timing
+                FMalloc* const PreviousMalloc = GMalloc;
+                FCountingMalloc CountingMalloc(PreviousMalloc);
+                GMalloc = &CountingMalloc;
+                for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+                {
+                    Print();
+                }
+                GMalloc = PreviousMalloc;
+
+                FResult& Result = Results.AddDefaulted_GetRef();
+                Result.PrintType = PrintTypeEnum->GetNameStringByIndex(TypeIndex);
+                Result.NumValues = NumValues;
+                Result.bLongLabels = bLongLabels;
+                Result.NanosecondsPerCall = FPlatformTime::ToSeconds64(Cycles) * 1e9 / Iterations;
+                Result.AllocationsPerCall = double(CountingMalloc.NumAllocations) / Iterations;
+                Result.BytesPerCall = double(CountingMalloc.NumBytes) / Iterations;
+
+                UE_LOG(LogDebugPrint, Display, TEXT("%-16s %2d values %-5s labels: %10.1f ns %8.2f allocs %10.1f bytes"),
+                    *Result.PrintType, NumValues, bLongLabels ? TEXT("long") : TEXT("short"), Result.NanosecondsPerCall,
+                    Result.AllocationsPerCall, Result.BytesPerCall);
+
+                FDebugPrintRenderer::Get().Clear();
+            }
+        }
+    }
+
+    // After the warmup every call should reuse the memory of the previous ones
+    int32 NumAllocatingCases = 0;
+    for (const FResult& Result : Results)
+    {
+        if (Result.AllocationsPerCall > 0.0)
+        {
+            NumAllocatingCases++;
+            UE_LOG(LogDebugPrint, Warning, TEXT("%s with %d values and %s labels allocates %.2f times per call"),
+                *Result.PrintType, Result.NumValues, Result.bLongLabels ? TEXT("long") : TEXT("short"), Result.AllocationsPerCall);
+        }
+    }
+    if (NumAllocatingCases == 0)
+    {
+        UE_LOG(LogDebugPrint, Display, TEXT("Steady state printing made no heap allocations"));
+    }
+
+    FString Json;
+    TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> Writer =
+        TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&Json);
+    Writer->WriteObjectStart();
+    Writer->WriteValue(TEXT("Iterations"), Iterations);
+    Writer->WriteValue(TEXT("AllocatingCases"), NumAllocatingCases);
+    Writer->WriteArrayStart(TEXT("Results"));
+    for (const FResult& Result : Results)
+    {
+        Writer->WriteObjectStart();
+        Writer->WriteValue(TEXT("PrintType"), Result.PrintType);
+        Writer->WriteValue(TEXT("NumValues"), Result.NumValues);
+        Writer->WriteValue(TEXT("Labels"), Result.bLongLabels ? TEXT("Long") : TEXT("Short"));
+        Writer->WriteValue(TEXT("NanosecondsPerCall"), Result.NanosecondsPerCall);
+        Writer->WriteValue(TEXT("AllocationsPerCall"), Result.AllocationsPerCall);
+        Writer->WriteValue(TEXT("BytesPerCall"), Result.BytesPerCall);
+        Writer->WriteObjectEnd();
+    }
+    Writer->WriteArrayEnd();
+    Writer->WriteObjectEnd();
+    Writer->Close();
+
+    if (!FFileHelper::SaveStringToFile(Json, *OutputPath))
+    {
+        UE_LOG(LogDebugPrint, Error, TEXT("Can't write benchmark results to %s"), *OutputPath);
+        return 1;
+    }
+
+    UE_LOG(LogDebugPrint, Display, TEXT("Benchmark results written to %s"), *OutputPath);
+    return bFailOnAllocations && NumAllocatingCases > 0 ? 1 : 0;
+}
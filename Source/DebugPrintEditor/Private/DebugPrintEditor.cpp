@@ -0,0 +1,50 @@
+// Copyright MoxAlehin. All Rights Reserved.
+
+#include "DebugPrintEditor.h"
+#include "DebugPrintDeveloperSettings.h"
+#include "Framework/Application/SlateApplication.h"
+#include "ISettingsModule.h"
+#include "Misc/CoreDelegates.h"
+#include "SDebugPrintReplay.h"
+#include "SDebugPrintWatch.h"
+#define LOCTEXT_NAMESPACE "FDebugPrintEditorModule"
+
+void FDebugPrintEditorModule::StartupModule()
+{
+	if (ISettingsModule* SettingsModule = FModuleManager::GetModulePtr<ISettingsModule>("Settings"))
+	{
+		SettingsModule->RegisterSettings(
+			"Editor",
+			"Plugins",
+			"Debug Print",
+			NSLOCTEXT("DebugPrint", "Debug Print Plugin Settings", "Debug Print"),
+			NSLOCTEXT("DebugPrint", "Debug Print Plugin Settings Description", "Debug Print Settings"),
+			GetMutableDefault<UDebugPrintDeveloperSettings>()  // Указатель на класс настроек
+		);
+	}
+
+	// The Developer Tools menu is only ready once the editor has started
+	if (GIsEditor && !IsRunningCommandlet())
+	{
+		FCoreDelegates::OnPostEngineInit.AddStatic(&SDebugPrintReplay::RegisterTabSpawner);
+		FCoreDelegates::OnPostEngineInit.AddStatic(&SDebugPrintWatch::RegisterTabSpawner);
+	}
+}
+
+void FDebugPrintEditorModule::ShutdownModule()
+{
+	if (FSlateApplication::IsInitialized())
+	{
+		SDebugPrintReplay::UnregisterTabSpawner();
+		SDebugPrintWatch::UnregisterTabSpawner();
+	}
+
+	if (ISettingsModule* SettingsModule = FModuleManager::GetModulePtr<ISettingsModule>("Settings"))
+	{
+		SettingsModule->UnregisterSettings("Editor", "Plugins", "Debug Print");
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
+	
+IMPLEMENT_MODULE(FDebugPrintEditorModule, DebugPrintEditor)
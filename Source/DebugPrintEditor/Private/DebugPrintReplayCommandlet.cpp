@@ -0,0 +1,66 @@
+// Copyright MoxAlehin. All Rights Reserved.
+
+#include "DebugPrintReplayCommandlet.h"
+
+#include "DebugPrint.h"
+#include "DebugPrintCaptureReader.h"
+
+UDebugPrintReplayCommandlet::UDebugPrintReplayCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = false;
+    LogToConsole = true;
+}
+
+int32 UDebugPrintReplayCommandlet::Main(const FString& Params)
+{
+    FString CapturePath;
+    if (!FParse::Value(*Params, TEXT("Capture="), CapturePath))
+    {
+        UE_LOG(LogDebugPrint, Error, TEXT("Usage: -run=DebugPrintReplay -Capture=<Path> [-Frame=<N>] [-Count=<N>] [-Step=<N>]"));
+        return 1;
+    }
+
+    FDebugPrintCaptureReader Reader;
+    FString Error;
+    if (!Reader.Open(CapturePath, Error))
+    {
+        UE_LOG(LogDebugPrint, Error, TEXT("%s"), *Error);
+        return 1;
+    }
+
+    UE_LOG(LogDebugPrint, Display, TEXT("%s: frames %llu to %llu in %d chunks, %d nodes"), *CapturePath, Reader.GetFirstFrame(),
+        Reader.GetLastFrame(), Reader.GetNumChunks(), Reader.GetNodes().Num());
+    for (const FDebugPrintCaptureNode& Node : Reader.GetNodes())
+    {
+        UE_LOG(LogDebugPrint, Display, TEXT("  %s: frames %llu to %llu, %s"), *Node.NodeGuid.ToString(), Node.FirstFrame,
+            Node.LastFrame, *FString::Join(Node.Labels, TEXT(", ")));
+    }
+
+    // By default only the last frame is shown
+    uint64 Frame = Reader.GetLastFrame();
+    int32 Count = 1;
+    int32 Step = 1;
+    FParse::Value(*Params, TEXT("Frame="), Frame);
+    FParse::Value(*Params, TEXT("Count="), Count);
+    FParse::Value(*Params, TEXT("Step="), Step);
+    Step = FMath::Max(Step, 1);
+
+    TArray<FDebugPrintCaptureTable> Tables;
+    for (int32 Index = 0; Index < Count && Frame <= Reader.GetLastFrame(); ++Index, Frame += Step)
+    {
+        Reader.Seek(Frame, Tables);
+        UE_LOG(LogDebugPrint, Display, TEXT("Frame %llu"), Frame);
+        for (const FDebugPrintCaptureTable& Table : Tables)
+        {
+            UE_LOG(LogDebugPrint, Display, TEXT("  %s (frame %llu, %.3f s)"), *Table.NodeGuid.ToString(), Table.Frame, Table.Time);
+            for (int32 Row = 0; Row < Table.Values.Num(); ++Row)
+            {
+                UE_LOG(LogDebugPrint, Display, TEXT("    %-24s %s"), *Table.Labels[Row], *Table.Values[Row]);
+            }
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,957 @@
+// Copyright MoxAlehin. All Rights Reserved.
+
+#include "K2Node_DebugPrint.h"
+
+#include "BlueprintNodeSpawner.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraphSchema_K2.h"
+#include "EditorCategoryUtils.h"
+#include "BlueprintActionDatabaseRegistrar.h"
+#include "K2Node_AssignmentStatement.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_EnumLiteral.h"
+#include "K2Node_IfThenElse.h"
+#include "K2Node_Knot.h"
+#include "K2Node_Literal.h"
+#include "K2Node_Self.h"
+#include "K2Node_TemporaryVariable.h"
+#include "KismetCompiler.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "DebugPrintDeveloperSettings.h"
+#include "DebugPrintDescriptor.h"
+#include "DebugPrintFormatter.h"
+#include "DebugPrintLibrary.h"
+
+#define LOCTEXT_NAMESPACE "K2Node"
+
+class UGraphEditorSettings;
+
+namespace DebugPrintNode
+{
+    FEdGraphPinType MakePinType(FName PinCategory)
+    {
+        FEdGraphPinType PinType;
+        PinType.PinCategory = PinCategory;
+        return PinType;
+    }
+}
+
+void UK2Node_DebugPrint::AllocateDefaultPins()
+{
+    const UDebugPrintDeveloperSettings* PluginSettings = GetDefault<UDebugPrintDeveloperSettings>();
+
+    // Create Exec pins
+    CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Exec, UEdGraphSchema_K2::PN_Execute);
+    CreatePin(EGPD_Output, UEdGraphSchema_K2::PC_Exec, UEdGraphSchema_K2::PN_Then);
+
+    // Create Value Wildcard Pins
+    for (int32 i = 0; i < ValueLabels.Num(); ++i)
+    {
+        CreateValuePin(i, DebugPrintNode::MakePinType(UEdGraphSchema_K2::PC_Wildcard));
+    }
+
+    // Create Print String options
+
+    UEdGraphPin* KeyPin = CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Name, TEXT("Key"));
+    KeyPin->bAdvancedView = true;
+    KeyPin->DefaultValue = TEXT("None");
+    KeyPin->PinToolTip =
+        TEXT("If a non-empty key is provided, the message will replace any existing on-screen messages with the same key.");
+
+    UEdGraphPin* SeparatorPin = CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_String, TEXT("Separator"));
+    SeparatorPin->bAdvancedView = true;
+    SeparatorPin->DefaultValue = PluginSettings->Separator;
+    SeparatorPin->PinToolTip = TEXT("The string used to separate each value.");
+
+    UEdGraphPin* TextColorPin = CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Struct, TEXT("TextColor"));
+    TextColorPin->PinType.PinSubCategoryObject = TBaseStructure<FLinearColor>::Get();
+    TextColorPin->bAdvancedView = true;
+    TextColorPin->DefaultValue = PluginSettings->TextColor.ToString();
+    TextColorPin->PinToolTip = TEXT("The color of the text to display.");
+
+    UEdGraphPin* DurationPin = CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Real, TEXT("Duration"));
+    DurationPin->bAdvancedView = true;
+    DurationPin->DefaultValue = FString::SanitizeFloat(PluginSettings->Duration);
+    DurationPin->PinToolTip = TEXT("The display duration.");
+
+    UEdGraphPin* PrintTypePin = CreatePin(EGPD_Input, UEdGraphSchema_K2::PC_Byte, StaticEnum<EPrintType>(), TEXT("PrintType"));
+    PrintTypePin->bAdvancedView = true;
+    PrintTypePin->PinToolTip = TEXT("Defines how the content will be displayed. Each option adds functionality to the one above it.");
+    PrintTypePin->DefaultValue = StaticEnum<EPrintType>()->GetNameStringByValue(PluginSettings->PrintType);
+
+    // Hiding Advanced pins
+    if (AdvancedPinDisplay == ENodeAdvancedPins::NoPins) AdvancedPinDisplay = ENodeAdvancedPins::Hidden;
+    Super::AllocateDefaultPins();
+}
+
+void UK2Node_DebugPrint::NodeConnectionListChanged()
+{
+    // Pins were already removed or retyped one by one, so only the visuals need a refresh
+    if (bPinsChanged)
+    {
+        bPinsChanged = false;
+        if (UEdGraph* Graph = GetGraph()) Graph->NotifyNodeChanged(this);
+    }
+}
+
+void UK2Node_DebugPrint::ExpandNode(class FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph)
+{
+    Super::ExpandNode(CompilerContext, SourceGraph);
+
+    if (GetDefault<UDebugPrintDeveloperSettings>()->ShouldStripNode(Category))
+    {
+        ExpandAsPassThrough();
+        return;
+    }
+
+    const UEdGraphSchema_K2* Schema = CompilerContext.GetSchema();
+    bool bIsErrorFree = true;
+
+    // Bake the final label prefixes so the runtime only has to append values.
+    // This has to happen before the links of the option pins are moved away
+    bool bSeparatorInLayout = false;
+    const TArray<FString> LabelPrefixes = BuildLabelPrefixes(bSeparatorInLayout);
+
+    // 1. Create a temporary node for the DebugPrint function
+    UK2Node_CallFunction* DebugPrintNode = CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(this, SourceGraph);
+    DebugPrintNode->FunctionReference.SetExternalMember(
+        GET_FUNCTION_NAME_CHECKED(UDebugPrintLibrary, DebugPrint), UDebugPrintLibrary::StaticClass());
+    DebugPrintNode->AllocateDefaultPins();
+
+    // 2. Bake unlinked options into the layout, pass linked ones as typed variadic arguments in front of the values
+    FDebugPrintOptionsLayout Options;
+    Options.bSeparatorInLayout = bSeparatorInLayout;
+    Options.bPrintOnChange = bPrintOnChange;
+
+    auto ExpandOption = [&](FName PinName, TOptional<FString>& OutLiteral)
+    {
+        UEdGraphPin* OptionPin = FindPinChecked(PinName);
+        if (OptionPin->LinkedTo.Num() == 0)
+        {
+            OutLiteral = OptionPin->GetDefaultAsString();
+            return;
+        }
+
+        // Real pins are read as double by the runtime
+        FEdGraphPinType PinType = OptionPin->PinType;
+        if (PinType.PinCategory == UEdGraphSchema_K2::PC_Real) PinType.PinSubCategory = UEdGraphSchema_K2::PC_Double;
+
+        UEdGraphPin* VariadicPin = DebugPrintNode->CreatePin(EGPD_Input, PinType, PinName);
+        bIsErrorFree &= CompilerContext.MovePinLinksToIntermediate(*OptionPin, *VariadicPin).CanSafeConnect();
+    };
+
+    ExpandOption(TEXT("Key"), Options.Key);
+    ExpandOption(TEXT("Separator"), Options.Separator);
+    ExpandOption(TEXT("TextColor"), Options.TextColor);
+    ExpandOption(TEXT("Duration"), Options.Duration);
+    ExpandOption(TEXT("PrintType"), Options.PrintType);
+
+    // The runtime reads the print type as a number
+    if (Options.PrintType.IsSet())
+    {
+        const int64 PrintTypeValue = StaticEnum<EPrintType>()->GetValueByNameString(Options.PrintType.GetValue());
+        Options.PrintType = FString::FromInt(PrintTypeValue != INDEX_NONE ? static_cast<int32>(PrintTypeValue) : int32(EPrintType::PrintInColumns));
+    }
+
+    // 3. Pass linked values as typed variadic arguments, bake unlinked values into the layout as text
+    TArray<UEdGraphPin*> ValuePins = GetValuePins();
+    TArray<FDebugPrintValueLayout> ValueLayouts;
+    UEdGraphPin* PrintExecPin = DebugPrintNode->GetExecPin();
+    for (int32 i = 0; i < ValuePins.Num(); ++i)
+    {
+        UEdGraphPin* ValuePin = ValuePins[i];
+        FDebugPrintValueLayout& ValueLayout = ValueLayouts.AddDefaulted_GetRef();
+        ValueLayout.Label = GetValueLabel(i);
+        ValueLayout.LabelPrefix = LabelPrefixes.IsValidIndex(i) ? LabelPrefixes[i] : FString();
+        const FDebugPrintNumberFormat* LabelFormat = LabelNumberFormats.Find(ValueLayout.Label);
+        ValueLayout.NumberFormat = LabelFormat ? *LabelFormat : NumberFormat;
+
+        if (ValuePin->LinkedTo.Num() == 0)
+        {
+            ValueLayout.Literal = FormatLiteral(ValuePin, ValueLayout.NumberFormat);
+            continue;
+        }
+
+        UEdGraphPin* SourcePin = ExpandValuePin(CompilerContext, SourceGraph, ValuePin, bIsErrorFree);
+        SourcePin = ExpandLocalVariable(CompilerContext, SourceGraph, ValuePin, SourcePin, PrintExecPin, bIsErrorFree);
+        UEdGraphPin* VariadicPin = DebugPrintNode->CreatePin(EGPD_Input, SourcePin->PinType, ValuePin->PinName);
+        if (SourcePin == ValuePin)
+        {
+            bIsErrorFree &= CompilerContext.MovePinLinksToIntermediate(*ValuePin, *VariadicPin).CanSafeConnect();
+        }
+        else
+        {
+            bIsErrorFree &= Schema->TryCreateConnection(SourcePin, VariadicPin);
+        }
+    }
+
+    // 4. Connect the exec pins, through the category check and the throttle gate if the node has one
+    UEdGraphPin* EntryPin = ExpandThrottleGate(CompilerContext, SourceGraph, PrintExecPin, bIsErrorFree);
+    EntryPin = ExpandCategoryGate(CompilerContext, SourceGraph, EntryPin, bIsErrorFree);
+    bIsErrorFree &= CompilerContext.MovePinLinksToIntermediate(*GetExecPin(), *EntryPin).CanSafeConnect();
+    bIsErrorFree &= CompilerContext.MovePinLinksToIntermediate(*GetThenPin(), *DebugPrintNode->GetThenPin()).CanSafeConnect();
+
+    // 5. Everything else is a literal of the call
+    const FString Layout = FDebugPrintNodeDescriptor::EncodeLayout(Options, ValueLayouts);
+    DebugPrintNode->FindPinChecked(TEXT("NodeGuid"))->DefaultValue = NodeGuid.ToString();
+    DebugPrintNode->FindPinChecked(TEXT("LayoutHash"))->DefaultValue = FString::FromInt(FDebugPrintNodeDescriptor::HashLayout(Layout));
+    DebugPrintNode->FindPinChecked(TEXT("Layout"))->DefaultValue = Layout;
+
+    if (!bIsErrorFree)
+    {
+        CompilerContext.MessageLog.Error(
+            *LOCTEXT("InternalConnectionError", "IsValidNode: Internal connection error. @@").ToString(), this);
+    }
+
+    BreakAllNodeLinks();
+}
+
+FString UK2Node_DebugPrint::FormatLiteral(const UEdGraphPin* ValuePin, const FDebugPrintNumberFormat& Format)
+{
+    // Numbers typed into the pin are formatted once here instead of on every execution
+    const FString DefaultValue = ValuePin->GetDefaultAsString();
+    const FName PinCategory = ValuePin->PinType.PinCategory;
+    if (PinCategory == UEdGraphSchema_K2::PC_Real && Format.Precision >= 0)
+    {
+        return FString::Printf(TEXT("%*.*f"), Format.MinWidth, Format.Precision, FCString::Atod(*DefaultValue));
+    }
+    if ((PinCategory == UEdGraphSchema_K2::PC_Int || PinCategory == UEdGraphSchema_K2::PC_Int64) && Format.MinWidth > 0)
+    {
+        return FString::Printf(TEXT("%*s"), Format.MinWidth, *DefaultValue);
+    }
+    return DefaultValue;
+}
+
+bool UK2Node_DebugPrint::HasAddress(const UEdGraphPin* SourcePin)
+{
+    // Look through reroute nodes to the pin that produces the value
+    while (SourcePin && SourcePin->GetOwningNode()->IsA<UK2Node_Knot>())
+    {
+        const UEdGraphPin* InputPin = CastChecked<UK2Node_Knot>(SourcePin->GetOwningNode())->GetInputPin();
+        SourcePin = InputPin->LinkedTo.Num() > 0 ? InputPin->LinkedTo[0] : nullptr;
+    }
+
+    // Self and literal nodes compile to constants in the bytecode, everything else is a variable or a function result
+    // that the compiler keeps in a local
+    const UEdGraphNode* SourceNode = SourcePin ? SourcePin->GetOwningNode() : nullptr;
+    return SourceNode && !SourceNode->IsA<UK2Node_Self>() && !SourceNode->IsA<UK2Node_Literal>()
+        && !SourceNode->IsA<UK2Node_EnumLiteral>();
+}
+
+UEdGraphPin* UK2Node_DebugPrint::ExpandLocalVariable(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph,
+    UEdGraphPin* ValuePin, UEdGraphPin* SourcePin, UEdGraphPin*& InOutPrintExecPin, bool& bIsErrorFree)
+{
+    const bool bSourceIsValuePin = SourcePin == ValuePin;
+    if (HasAddress(bSourceIsValuePin ? ValuePin->LinkedTo[0] : SourcePin))
+    {
+        return SourcePin;
+    }
+
+    // The print call reads values by address, so constants are copied into a local right before it
+    const FEdGraphPinType& PinType = SourcePin->PinType;
+    UK2Node_TemporaryVariable* LocalNode = CompilerContext.SpawnInternalVariable(this, PinType.PinCategory,
+        PinType.PinSubCategory, PinType.PinSubCategoryObject.Get(), PinType.ContainerType, PinType.PinValueType);
+
+    UK2Node_AssignmentStatement* AssignNode = CompilerContext.SpawnIntermediateNode<UK2Node_AssignmentStatement>(this, SourceGraph);
+    AssignNode->AllocateDefaultPins();
+
+    const UEdGraphSchema_K2* Schema = CompilerContext.GetSchema();
+    bIsErrorFree &= Schema->TryCreateConnection(LocalNode->GetVariablePin(), AssignNode->GetVariablePin());
+    AssignNode->NotifyPinConnectionListChanged(AssignNode->GetVariablePin());
+    if (bSourceIsValuePin)
+    {
+        bIsErrorFree &= CompilerContext.MovePinLinksToIntermediate(*ValuePin, *AssignNode->GetValuePin()).CanSafeConnect();
+    }
+    else
+    {
+        bIsErrorFree &= Schema->TryCreateConnection(SourcePin, AssignNode->GetValuePin());
+    }
+
+    // Assignments run after the gates, so a throttled or filtered node does not evaluate its values
+    bIsErrorFree &= Schema->TryCreateConnection(AssignNode->GetThenPin(), InOutPrintExecPin);
+    InOutPrintExecPin = AssignNode->GetExecPin();
+
+    return LocalNode->GetVariablePin();
+}
+
+void UK2Node_DebugPrint::ExpandAsPassThrough()
+{
+    // Wire every incoming exec link straight to the node that follows. Pure nodes feeding the values are left unused
+    // and pruned by the compiler
+    UEdGraphPin* ThenPin = GetThenPin();
+    if (ThenPin->LinkedTo.Num() > 0)
+    {
+        UEdGraphPin* NextPin = ThenPin->LinkedTo[0];
+        for (UEdGraphPin* SourcePin : GetExecPin()->LinkedTo)
+        {
+            SourcePin->MakeLinkTo(NextPin);
+        }
+    }
+
+    BreakAllNodeLinks();
+}
+
+UEdGraphPin* UK2Node_DebugPrint::ExpandThrottleGate(
+    FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph, UEdGraphPin* PrintExecPin, bool& bIsErrorFree)
+{
+    if (MaxUpdateRate <= 0.f && PrintEveryNth <= 1 && SampleChance >= 1.f)
+    {
+        return PrintExecPin;
+    }
+
+    const UEdGraphSchema_K2* Schema = CompilerContext.GetSchema();
+
+    UK2Node_CallFunction* GateNode = CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(this, SourceGraph);
+    GateNode->FunctionReference.SetExternalMember(
+        GET_FUNCTION_NAME_CHECKED(UDebugPrintLibrary, ShouldPrint), UDebugPrintLibrary::StaticClass());
+    GateNode->AllocateDefaultPins();
+
+    GateNode->FindPinChecked(TEXT("NodeGuid"))->DefaultValue = NodeGuid.ToString();
+    GateNode->FindPinChecked(TEXT("MaxUpdateRate"))->DefaultValue = FString::SanitizeFloat(MaxUpdateRate);
+    GateNode->FindPinChecked(TEXT("PrintEveryNth"))->DefaultValue = FString::FromInt(PrintEveryNth);
+    GateNode->FindPinChecked(TEXT("SampleChance"))->DefaultValue = FString::SanitizeFloat(SampleChance);
+
+    // Branch on the gate, so the pure nodes feeding the values only run when the node prints
+    UK2Node_IfThenElse* BranchNode = CompilerContext.SpawnIntermediateNode<UK2Node_IfThenElse>(this, SourceGraph);
+    BranchNode->AllocateDefaultPins();
+
+    bIsErrorFree &= Schema->TryCreateConnection(GateNode->GetThenPin(), BranchNode->GetExecPin());
+    bIsErrorFree &= Schema->TryCreateConnection(GateNode->GetReturnValuePin(), BranchNode->GetConditionPin());
+    bIsErrorFree &= Schema->TryCreateConnection(BranchNode->GetThenPin(), PrintExecPin);
+    bIsErrorFree &= CompilerContext.CopyPinLinksToIntermediate(*GetThenPin(), *BranchNode->GetElsePin()).CanSafeConnect();
+
+    return GateNode->GetExecPin();
+}
+
+UEdGraphPin* UK2Node_DebugPrint::ExpandCategoryGate(
+    FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph, UEdGraphPin* NodeExecPin, bool& bIsErrorFree)
+{
+    const UEdGraphSchema_K2* Schema = CompilerContext.GetSchema();
+
+    UK2Node_CallFunction* CheckNode = CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(this, SourceGraph);
+    CheckNode->FunctionReference.SetExternalMember(
+        GET_FUNCTION_NAME_CHECKED(UDebugPrintLibrary, IsCategoryEnabled), UDebugPrintLibrary::StaticClass());
+    CheckNode->AllocateDefaultPins();
+    CheckNode->FindPinChecked(TEXT("Category"))->DefaultValue = Category.ToString();
+
+    // A switched off node goes straight to the next node, skipping the throttle state and the values
+    UK2Node_IfThenElse* BranchNode = CompilerContext.SpawnIntermediateNode<UK2Node_IfThenElse>(this, SourceGraph);
+    BranchNode->AllocateDefaultPins();
+
+    bIsErrorFree &= Schema->TryCreateConnection(CheckNode->GetReturnValuePin(), BranchNode->GetConditionPin());
+    bIsErrorFree &= Schema->TryCreateConnection(BranchNode->GetThenPin(), NodeExecPin);
+    bIsErrorFree &= CompilerContext.CopyPinLinksToIntermediate(*GetThenPin(), *BranchNode->GetElsePin()).CanSafeConnect();
+
+    return BranchNode->GetExecPin();
+}
+
+UEdGraphPin* UK2Node_DebugPrint::ExpandValuePin(
+    FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph, UEdGraphPin* ValuePin, bool& bIsErrorFree)
+{
+    // Only user structs need a conversion, everything else is formatted natively
+    const UScriptStruct* Struct = Cast<UScriptStruct>(ValuePin->PinType.PinSubCategoryObject.Get());
+    if (ValuePin->PinType.PinCategory != UEdGraphSchema_K2::PC_Struct || ValuePin->PinType.IsContainer() ||
+        FDebugPrintFormatter::IsFormattedNatively(Struct))
+    {
+        return ValuePin;
+    }
+
+    FEdGraphPinType StringPinType;
+    StringPinType.PinCategory = UEdGraphSchema_K2::PC_String;
+    TOptional<UEdGraphSchema_K2::FSearchForAutocastFunctionResults> Autocast =
+        CompilerContext.GetSchema()->SearchForAutocastFunction(ValuePin->PinType, StringPinType);
+    if (!Autocast.IsSet())
+    {
+        return ValuePin;
+    }
+
+    // Call the BlueprintAutocast ToString function of the struct and pass its result instead
+    UK2Node_CallFunction* ConvertNode = CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(this, SourceGraph);
+    ConvertNode->FunctionReference.SetExternalMember(Autocast->TargetFunction, Autocast->FunctionOwner);
+    ConvertNode->AllocateDefaultPins();
+
+    for (UEdGraphPin* Pin : ConvertNode->Pins)
+    {
+        if (Pin->Direction == EGPD_Input && Pin->PinName != UEdGraphSchema_K2::PN_Self)
+        {
+            bIsErrorFree &= CompilerContext.MovePinLinksToIntermediate(*ValuePin, *Pin).CanSafeConnect();
+            break;
+        }
+    }
+
+    return ConvertNode->GetReturnValuePin();
+}
+
+FString UK2Node_DebugPrint::GetValueLabel(int32 Index) const
+{
+    return !ValueLabels.IsValidIndex(Index) || ValueLabels[Index] == "" ? FString::Printf(TEXT("Value %d"), Index) : ValueLabels[Index];
+}
+
+TArray<FString> UK2Node_DebugPrint::BuildLabelPrefixes(bool& bOutSeparatorInLayout) const
+{
+    TArray<FString> Prefixes;
+    for (int32 i = 0; i < ValueLabels.Num(); ++i)
+    {
+        Prefixes.Add(GetValueLabel(i));
+    }
+
+    // A linked PrintType pin is only known at runtime, so fall back to the column layout
+    const UEdGraphPin* PrintTypePin = FindPin(TEXT("PrintType"));
+    const bool bPadLabels = !PrintTypePin || PrintTypePin->LinkedTo.Num() > 0 ||
+                            StaticEnum<EPrintType>()->GetValueByNameString(PrintTypePin->DefaultValue) == EPrintType::PrintInColumns;
+
+    // If the type is "PrintInColumns", align all labels to form a table-like structure
+    if (bPadLabels)
+    {
+        int32 MaxLength = 0;
+        for (const FString& Prefix : Prefixes)
+        {
+            MaxLength = FMath::Max(MaxLength, Prefix.Len());
+        }
+
+        for (FString& Prefix : Prefixes)
+        {
+            Prefix += FString::ChrN(MaxLength - Prefix.Len(), ' ');
+        }
+    }
+
+    // A linked Separator pin is appended at runtime instead
+    const UEdGraphPin* SeparatorPin = FindPin(TEXT("Separator"));
+    bOutSeparatorInLayout = SeparatorPin && SeparatorPin->LinkedTo.Num() == 0;
+    if (bOutSeparatorInLayout)
+    {
+        for (FString& Prefix : Prefixes)
+        {
+            Prefix += SeparatorPin->DefaultValue;
+        }
+    }
+
+    return Prefixes;
+}
+
+FString UK2Node_DebugPrint::GetSmartLabelFromPin(UEdGraphPin* Pin) const
+{
+    if (!Pin || Pin->LinkedTo.Num() == 0)
+    {
+        return TEXT("");
+    }
+
+    // Get the pin from the source node
+    UEdGraphPin* SourcePin = Pin->LinkedTo[0];
+    FString PinLabel =
+        SourcePin->PinFriendlyName.IsEmpty() ? SourcePin->GetDisplayName().ToString() : SourcePin->PinFriendlyName.ToString();
+
+    // Check if pin label is "Return Value" or empty
+    if (PinLabel == TEXT("Return Value") || PinLabel.IsEmpty())
+    {
+        // Get the source node
+        UEdGraphNode* SourceNode = SourcePin->GetOwningNode();
+        if (SourceNode)
+        {
+            // Get the node title
+            FString NodeTitle = SourceNode->GetNodeTitle(ENodeTitleType::MenuTitle).ToString();
+
+            // Remove "Get " prefix if present
+            if (NodeTitle.StartsWith(TEXT("Get ")))
+            {
+                NodeTitle.RightChopInline(4);  // Remove "Get "
+            }
+            else if (NodeTitle.Len() > 3 && NodeTitle.StartsWith(TEXT("Get")))
+            {
+                // Check for "Get" prefix without space (e.g., "GetParam")
+                FString AfterGet = NodeTitle.Mid(3);
+                // If the next character is uppercase or the rest is empty, remove "Get"
+                if (AfterGet.Len() == 0 || FChar::IsUpper(AfterGet[0]))
+                {
+                    NodeTitle = AfterGet;
+                }
+            }
+
+            // Return the processed node title
+            return NodeTitle;
+        }
+    }
+
+    return PinLabel;
+}
+
+void UK2Node_DebugPrint::NotifyPinConnectionListChanged(UEdGraphPin* Pin)
+{
+    const int32 Index = GetValuePinIndex(Pin);
+    if (Index != INDEX_NONE)
+    {
+        if (Pin->LinkedTo.Num() == 0)
+        {
+            RemoveInputPin(Pin);
+        }
+        else
+        {
+            // When a pin is connected, update its label with smart label from source
+            Modify();
+
+            // Take the type of the connected pin right away instead of reconstructing the node
+            if (Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Wildcard)
+            {
+                Pin->PinType = Pin->LinkedTo[0]->PinType;
+                bPinsChanged = true;
+            }
+
+            // Get the smart label from the connected pin
+            FString NewLabel = GetSmartLabelFromPin(Pin);
+
+            if (!NewLabel.IsEmpty() && ValueLabels.IsValidIndex(Index) && NewLabel != ValueLabels[Index])
+            {
+                ValueLabels[Index] = NewLabel;
+                MakeLabelUnique(Index);
+                Pin->PinFriendlyName = FText::FromString(ValueLabels[Index]);
+                bPinsChanged = true;
+
+                FBlueprintEditorUtils::MarkBlueprintAsModified(GetBlueprint());
+            }
+        }
+    }
+}
+
+void UK2Node_DebugPrint::RemoveInputPin(UEdGraphPin* PinToRemove)
+{
+    const int32 Index = GetValuePinIndex(PinToRemove);
+    if (Index == INDEX_NONE || !Pins.Contains(PinToRemove))
+    {
+        return;
+    }
+
+    // Open a transaction to support undo/redo
+    Modify();
+
+    // Remove the pin together with its split sub pins and the corresponding label
+    RemovePin(PinToRemove);
+    if (ValueLabels.IsValidIndex(Index)) ValueLabels.RemoveAt(Index);
+
+    // Only the pins after the removed one change their index
+    for (UEdGraphPin* Pin : GetValuePins())
+    {
+        const int32 PinIndex = GetValuePinIndex(Pin);
+        if (PinIndex > Index)
+        {
+            Pin->Modify();
+            Pin->PinName = GetValuePinName(PinIndex - 1);
+        }
+    }
+    bPinsChanged = true;
+
+    // Notify the Blueprint that the node has changed
+    FBlueprintEditorUtils::MarkBlueprintAsModified(GetBlueprint());
+}
+
+void UK2Node_DebugPrint::ReallocatePinsDuringReconstruction(TArray<UEdGraphPin*>& OldPins)
+{
+    Super::ReallocatePinsDuringReconstruction(OldPins);
+
+    // Restore the types of the value pins, matched by their index instead of searching by name
+    const TArray<UEdGraphPin*> ValuePins = GetValuePins();
+    for (UEdGraphPin* OldPin : OldPins)
+    {
+        const int32 Index = GetValuePinIndex(OldPin);
+        UEdGraphPin* NewPin = ValuePins.IsValidIndex(Index) ? ValuePins[Index] : nullptr;
+        if (NewPin && NewPin->PinType.PinCategory == UEdGraphSchema_K2::PC_Wildcard)
+        {
+            // Restore wildcard pin type
+            NewPin->PinType = OldPin->PinType;
+        }
+    }
+}
+
+void UK2Node_DebugPrint::PostReconstructNode()
+{
+    Super::PostReconstructNode();
+
+    // Restore pin types based on existing connections
+    TArray<UEdGraphPin*> ValuePins = GetValuePins();
+
+    for (UEdGraphPin* Pin : ValuePins)
+    {
+        // Restore pin types based on existing connections
+        if (Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Wildcard && Pin->LinkedTo.Num() > 0)
+        {
+            Pin->PinType = Pin->LinkedTo[0]->PinType;
+        }
+    }
+}
+
+// UK2Node_EditablePinBase
+
+UEdGraphPin* UK2Node_DebugPrint::CreatePinFromUserDefinition(const TSharedPtr<FUserPinInfo> NewPinInfo)
+{
+    ValueLabels.Add(NewPinInfo->PinName.ToString());
+    MakeLabelUnique(ValueLabels.Num() - 1);
+    UEdGraphPin* NewPin = CreateValuePin(ValueLabels.Num() - 1, NewPinInfo->PinType);
+    UserDefinedPins.RemoveAt(0);
+    return NewPin;
+}
+
+bool UK2Node_DebugPrint::CanCreateUserDefinedPin(
+    const FEdGraphPinType& InPinType, EEdGraphPinDirection InDesiredDirection, FText& OutErrorMessage)
+{
+    // Disallow Output pins
+    if (InDesiredDirection == EGPD_Output)
+    {
+        OutErrorMessage = LOCTEXT("OutputPinNotAllowed", "Cannot add Output pins!");
+        return false;
+    }
+
+    // Disallow Exec pins
+    if (InPinType.PinCategory == UEdGraphSchema_K2::PC_Exec)
+    {
+        OutErrorMessage = LOCTEXT("ExecPinNotAllowed", "Cannot add Exec pins!");
+        return false;
+    }
+
+    // Default: allow adding the pin
+    return true;
+}
+
+TArray<UEdGraphPin*> UK2Node_DebugPrint::GetValuePins() const
+{
+    TArray<UEdGraphPin*> ValuePins;
+    ValuePins.Reserve(ValueLabels.Num());
+
+    for (UEdGraphPin* Pin : Pins)
+    {
+        if (GetValuePinIndex(Pin) != INDEX_NONE)
+        {
+            ValuePins.Add(Pin);
+        }
+    }
+
+    return ValuePins;
+}
+
+FName UK2Node_DebugPrint::GetValuePinName(int32 Index)
+{
+    return FName(TEXT("Value"), NAME_EXTERNAL_TO_INTERNAL(Index));
+}
+
+int32 UK2Node_DebugPrint::GetValuePinIndex(const UEdGraphPin* Pin)
+{
+    // "Value_3" is stored as "Value" with the number 3, so the index is read without converting the name to a string.
+    // Split sub pins like "Value_3_X" don't end with a number and are skipped
+    static const FName ValuePinBaseName(TEXT("Value"));
+    if (!Pin || Pin->ParentPin || Pin->PinName.GetComparisonIndex() != ValuePinBaseName.GetComparisonIndex() ||
+        Pin->PinName.GetNumber() == NAME_NO_NUMBER_INTERNAL)
+    {
+        return INDEX_NONE;
+    }
+    return NAME_INTERNAL_TO_EXTERNAL(Pin->PinName.GetNumber());
+}
+
+UEdGraphPin* UK2Node_DebugPrint::CreateValuePin(int32 Index, const FEdGraphPinType& PinType)
+{
+    UEdGraphPin* NewPin = CreatePin(EGPD_Input, PinType, GetValuePinName(Index));
+    if (PinType.PinCategory == UEdGraphSchema_K2::PC_Wildcard)
+    {
+        NewPin->PinToolTip = TEXT("Wildcard input pin. Type will be determined by what is connected.");
+    }
+    if (ValueLabels.IsValidIndex(Index))
+    {
+        NewPin->PinFriendlyName = FText::FromString(ValueLabels[Index]);
+    }
+
+    // Keep the value pins together after the exec pins, so the node doesn't have to be reconstructed to sort them
+    int32 InsertIndex = 0;
+    for (int32 PinIndex = 0; PinIndex < Pins.Num() - 1; ++PinIndex)
+    {
+        const UEdGraphPin* RootPin = Pins[PinIndex];
+        while (RootPin->ParentPin) RootPin = RootPin->ParentPin;
+
+        if (RootPin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec || GetValuePinIndex(RootPin) != INDEX_NONE)
+        {
+            InsertIndex = PinIndex + 1;
+        }
+    }
+    if (InsertIndex != Pins.Num() - 1)
+    {
+        Pins.Insert(NewPin, InsertIndex);
+        Pins.RemoveAt(Pins.Num() - 1);
+    }
+
+    return NewPin;
+}
+
+// RMB Node Menu
+
+void UK2Node_DebugPrint::GetNodeContextMenuActions(UToolMenu* Menu, UGraphNodeContextMenuContext* Context) const
+{
+    Super::GetNodeContextMenuActions(Menu, Context);
+
+    if (Context && !Context->Pin)
+    {
+        // Adding a new section for the "Add String Pin" option
+        FToolMenuSection& Section = Menu->AddSection("K2NodeDebugPrintAddPin", LOCTEXT("AddPinHeader", "Add Pin"));
+        Section.AddMenuEntry("AddStringPin", LOCTEXT("AddStringPin", "Add String Pin"),
+            LOCTEXT("AddStringPinTooltip", "Add a new String pin to the node."), FSlateIcon(),
+            FUIAction(FExecuteAction::CreateUObject(const_cast<UK2Node_DebugPrint*>(this), &UK2Node_DebugPrint::AddStringPin)));
+    }
+
+    // Check if the pin is a value pin
+    if (Context && Context->Pin && GetValuePinIndex(Context->Pin) != INDEX_NONE)
+    {
+        FToolMenuSection& Section = Menu->AddSection("K2NodeDebugPrint", LOCTEXT("RemovePinHeader", "Remove Pin"));
+        // // Add the "Remove Pin" action
+        // Section.AddMenuEntry(
+        //     "RemovePin",
+        //     LOCTEXT("RemovePin", "Remove Pin"),
+        //     LOCTEXT("RemovePinTooltip", "Remove this input pin."),
+        //     FSlateIcon(),
+        //     FUIAction(FExecuteAction::CreateUObject(const_cast<UK2Node_DebugPrint*>(this), &UK2Node_DebugPrint::RemoveInputPin,
+        //     const_cast<UEdGraphPin*>(Context->Pin)))
+        // );
+
+        // Add the "Reset to Wildcard" option if the pin is not connected and not already a wildcard
+        if (Context->Pin->LinkedTo.Num() == 0 && Context->Pin->PinType.PinCategory != UEdGraphSchema_K2::PC_Wildcard)
+        {
+            Section.AddMenuEntry("ResetPinToWildcard", LOCTEXT("ResetPinToWildcard", "Reset pin to Wildcard"),
+                LOCTEXT("ResetPinToWildcardTooltip", "Reset this pin's type to Wildcard."), FSlateIcon(),
+                FUIAction(FExecuteAction::CreateUObject(const_cast<UK2Node_DebugPrint*>(this), &UK2Node_DebugPrint::ResetPinToWildcard,
+                    const_cast<UEdGraphPin*>(Context->Pin))));
+        }
+    }
+}
+
+void UK2Node_DebugPrint::ResetPinToWildcard(UEdGraphPin* PinToReset)
+{
+    if (!PinToReset || PinToReset->LinkedTo.Num() > 0)
+    {
+        return;
+    }
+
+    // Open a transaction to support undo/redo
+    FScopedTransaction Transaction(LOCTEXT("ResetPinToWildcardTx", "Reset Pin to Wildcard"));
+    Modify();
+
+    const UEdGraphSchema_K2* Schema = GetDefault<UEdGraphSchema_K2>();
+
+    // If the pin is a child, it needs to be recombined
+    UEdGraphPin* ParentPin = PinToReset->ParentPin ? PinToReset->ParentPin : PinToReset;
+    Schema->RecombinePin(PinToReset);
+    PinToReset = ParentPin;
+
+    // Change the pin type to wildcard
+    PinToReset->PinType.PinCategory = UEdGraphSchema_K2::PC_Wildcard;
+    PinToReset->PinType.PinSubCategory = NAME_None;
+    PinToReset->PinType.PinSubCategoryObject = nullptr;
+    PinToReset->PinType.ContainerType = EPinContainerType::None;
+    PinToReset->PinType.PinValueType = FEdGraphTerminalType();
+
+    // Mark the Blueprint as modified to reflect the changes
+    FBlueprintEditorUtils::MarkBlueprintAsModified(GetBlueprint());
+
+    // Rebuild the node for visual updates
+    ReconstructNode();
+}
+
+void UK2Node_DebugPrint::AddStringPin()
+{
+    Modify();  // Begin a transaction to support Undo/Redo
+
+    const int32 Index = ValueLabels.Num();
+    ValueLabels.Add(FString::Printf(TEXT("%d"), Index));
+    MakeLabelUnique(Index);
+
+    // Create a new pin of type String
+    UEdGraphPin* StringPin = CreateValuePin(Index, DebugPrintNode::MakePinType(UEdGraphSchema_K2::PC_String));
+    StringPin->DefaultValue = TEXT("Section");
+
+    // Refresh the node to reflect the changes in the editor
+    FBlueprintEditorUtils::MarkBlueprintAsModified(GetBlueprint());
+    GetGraph()->NotifyNodeChanged(this);
+}
+
+// Details Panel
+
+void UK2Node_DebugPrint::PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent)
+{
+    FName PropertyName = (PropertyChangedEvent.Property != nullptr) ? PropertyChangedEvent.Property->GetFName() : NAME_None;
+    if (PropertyName == TEXT("ValueLabels"))
+    {
+        // Handle array changes safely
+        if (PropertyChangedEvent.ChangeType == EPropertyChangeType::ArrayAdd ||
+            PropertyChangedEvent.ChangeType == EPropertyChangeType::ArrayRemove ||
+            PropertyChangedEvent.ChangeType == EPropertyChangeType::ValueSet)
+        {
+            OnValueLabelsChange();
+            FBlueprintEditorUtils::MarkBlueprintAsModified(GetBlueprint());
+            GetGraph()->NotifyNodeChanged(this);
+        }
+    }
+
+    Super::PostEditChangeProperty(PropertyChangedEvent);
+}
+
+void UK2Node_DebugPrint::OnValueLabelsChange()
+{
+    TArray<UEdGraphPin*> ValuePins = GetValuePins();
+
+    // Ensure ValueLabels array has valid entries
+    for (int32 Index = 0; Index < ValueLabels.Num(); ++Index)
+    {
+        if (ValueLabels[Index] == "") ValueLabels[Index] = FString::Printf(TEXT("%d"), Index);
+    }
+    MakeLabelsUnique();
+
+    // If ValueLabels array has grown, we need to create new pins
+    if (ValueLabels.Num() > ValuePins.Num())
+    {
+        // Create new pins for the additional labels
+        for (int32 Index = ValuePins.Num(); Index < ValueLabels.Num(); ++Index)
+        {
+            CreateValuePin(Index, DebugPrintNode::MakePinType(UEdGraphSchema_K2::PC_Wildcard));
+        }
+    }
+    // If ValueLabels array has shrunk, remove excess pins
+    else if (ValueLabels.Num() < ValuePins.Num())
+    {
+        for (int32 Index = ValueLabels.Num(); Index < ValuePins.Num(); ++Index)
+        {
+            RemovePin(ValuePins[Index]);
+        }
+        ValuePins.SetNum(ValueLabels.Num());
+    }
+
+    // Update the friendly names of the pins whose label changed
+    for (int32 Index = 0; Index < ValuePins.Num(); ++Index)
+    {
+        if (!ValuePins[Index]->PinFriendlyName.ToString().Equals(ValueLabels[Index], ESearchCase::CaseSensitive))
+        {
+            ValuePins[Index]->PinFriendlyName = FText::FromString(ValueLabels[Index]);
+        }
+    }
+}
+
+void UK2Node_DebugPrint::MakeLabelsUnique()
+{
+    // Set to track occurrences of each string
+    TSet<FString> LabelsSet;
+    LabelsSet.Reserve(ValueLabels.Num());
+
+    // Next number to try for every label stem, so repeated labels don't probe the same numbers again
+    TMap<FString, int32> NextNumbers;
+
+    for (FString& Label : ValueLabels)
+    {
+        if (LabelsSet.Contains(Label))
+        {
+            int32 LabelNumber;
+            FString LabelString;
+            SplitStringAndNumber(Label, LabelString, LabelNumber);
+
+            int32& NextNumber = NextNumbers.FindOrAdd(LabelString, 1);
+            NextNumber = FMath::Max(NextNumber, LabelNumber == INDEX_NONE ? 1 : LabelNumber + 1);
+            do
+            {
+                Label = FString::Printf(TEXT("%s%d"), *LabelString, NextNumber++);
+            }
+            while (LabelsSet.Contains(Label));
+        }
+        LabelsSet.Add(Label);
+    }
+}
+
+void UK2Node_DebugPrint::MakeLabelUnique(int32 Index)
+{
+    // Only the changed label is renamed, the others are already unique
+    TSet<FString> OtherLabels;
+    OtherLabels.Reserve(ValueLabels.Num());
+    for (int32 i = 0; i < ValueLabels.Num(); ++i)
+    {
+        if (i != Index) OtherLabels.Add(ValueLabels[i]);
+    }
+
+    FString& Label = ValueLabels[Index];
+    if (OtherLabels.Contains(Label))
+    {
+        int32 LabelNumber;
+        FString LabelString;
+        SplitStringAndNumber(Label, LabelString, LabelNumber);
+        LabelNumber = LabelNumber == INDEX_NONE ? 1 : LabelNumber + 1;
+        do
+        {
+            Label = FString::Printf(TEXT("%s%d"), *LabelString, LabelNumber++);
+        }
+        while (OtherLabels.Contains(Label));
+    }
+}
+
+void UK2Node_DebugPrint::SplitStringAndNumber(const FString& InputString, FString& OutString, int32& OutNumber)
+{
+    // Initialize output variables
+    OutNumber = INDEX_NONE;   // indicates no number found
+    OutString = InputString;  // Default to returning the entire input string
+
+    // Traverse the string from the end to find a sequence of digits
+    int32 Index = InputString.Len() - 1;
+
+    while (Index >= 0 && FChar::IsDigit(InputString[Index]))
+    {
+        Index--;
+    }
+
+    // If digits are found at the end of the string
+    if (Index < InputString.Len() - 1)
+    {
+        // Extract the numeric part
+        FString NumberPart = InputString.Mid(Index + 1);
+        OutNumber = FCString::Atoi(*NumberPart);  // Convert the numeric part to an integer
+
+        // Extract the remaining non-numeric part of the string
+        OutString = InputString.Left(Index + 1);  // Get the part of the string without the numeric portion
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////////////
+// VISUALS
+//////////////////////////////////////////////////////////////////////////////////////
+
+FName UK2Node_DebugPrint::GetCornerIcon() const
+{
+    return TEXT("Graph.Message.MessageIcon");
+}
+
+FText UK2Node_DebugPrint::GetMenuCategory() const
+{
+    return FEditorCategoryUtils::GetCommonCategory(FCommonEditorCategory::Development);
+}
+
+void UK2Node_DebugPrint::GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const
+{
+    UClass* ActionKey = GetClass();
+    if (ActionRegistrar.IsOpenForRegistration(ActionKey))
+    {
+        UBlueprintNodeSpawner* NodeSpawner = UBlueprintNodeSpawner::Create(GetClass());
+        check(NodeSpawner != nullptr);
+
+        ActionRegistrar.AddBlueprintAction(ActionKey, NodeSpawner);
+    }
+}
+
+FText UK2Node_DebugPrint::GetTooltipText() const
+{
+    return LOCTEXT("DebugPrintNode_Tooltip", "DebugPrintNode_Tooltip");
+}
+
+FLinearColor UK2Node_DebugPrint::GetNodeTitleColor() const
+{
+    return FLinearColor(1.f, 1.f, 0.f);
+}
+
+FText UK2Node_DebugPrint::GetNodeTitle(ENodeTitleType::Type TitleType) const
+{
+    return LOCTEXT("DebugPrint", "Debug Print");
+}
+
+FSlateIcon UK2Node_DebugPrint::GetIconAndTint(FLinearColor& OutColor) const
+{
+    static FSlateIcon Icon("EditorStyle", "Kismet.AllClasses.FunctionIcon");
+    return Icon;
+}
+
+#undef LOCTEXT_NAMESPACE
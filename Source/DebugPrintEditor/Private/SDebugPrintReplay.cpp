@@ -0,0 +1,225 @@
+// Copyright MoxAlehin. All Rights Reserved.
+
+#include "SDebugPrintReplay.h"
+
+#include "Framework/Docking/TabManager.h"
+#include "Misc/Paths.h"
+#include "Styling/AppStyle.h"
+#include "Widgets/Docking/SDockTab.h"
+#include "Widgets/Input/SButton.h"
+#include "Widgets/Input/SEditableTextBox.h"
+#include "Widgets/Input/SSlider.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/Layout/SScrollBox.h"
+#include "Widgets/Text/STextBlock.h"
+#include "WorkspaceMenuStructure.h"
+#include "WorkspaceMenuStructureModule.h"
+
+#define LOCTEXT_NAMESPACE "SDebugPrintReplay"
+
+const FName SDebugPrintReplay::TabName(TEXT("DebugPrintReplay"));
+
+void SDebugPrintReplay::RegisterTabSpawner()
+{
+    FGlobalTabmanager::Get()->RegisterNomadTabSpawner(TabName, FOnSpawnTab::CreateLambda([](const FSpawnTabArgs&)
+        {
+            return SNew(SDockTab).TabRole(ETabRole::NomadTab)[SNew(SDebugPrintReplay)];
+        }))
+        .SetDisplayName(LOCTEXT("TabTitle", "DebugPrint Replay"))
+        .SetTooltipText(LOCTEXT("TabTooltip", "Plays back recorded DebugPrint captures frame by frame."))
+        .SetGroup(WorkspaceMenu::GetMenuStructure().GetDeveloperToolsDebugCategory());
+}
+
+void SDebugPrintReplay::UnregisterTabSpawner()
+{
+    FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(TabName);
+}
+
+void SDebugPrintReplay::Construct(const FArguments& InArgs)
+{
+    ChildSlot
+    [
+        SNew(SVerticalBox)
+        + SVerticalBox::Slot()
+        .AutoHeight()
+        .Padding(4.f)
+        [
+            SNew(SHorizontalBox)
+            + SHorizontalBox::Slot()
+            .FillWidth(1.f)
+            [
+                SAssignNew(PathBox, SEditableTextBox)
+                .Text(FText::FromString(FPaths::ProjectSavedDir() / TEXT("DebugPrint") / TEXT("")))
+                .HintText(LOCTEXT("PathHint", "Path of a .dprec capture"))
+            ]
+            + SHorizontalBox::Slot()
+            .AutoWidth()
+            .Padding(4.f, 0.f, 0.f, 0.f)
+            [
+                SNew(SButton)
+                .Text(LOCTEXT("Open", "Open"))
+                .OnClicked(this, &SDebugPrintReplay::OnOpenClicked)
+            ]
+        ]
+        + SVerticalBox::Slot()
+        .AutoHeight()
+        .Padding(4.f)
+        [
+            SNew(SHorizontalBox)
+            + SHorizontalBox::Slot()
+            .AutoWidth()
+            [
+                SNew(SButton)
+                .Text(LOCTEXT("PreviousFrame", "<"))
+                .OnClicked(this, &SDebugPrintReplay::OnStepClicked, -1)
+            ]
+            + SHorizontalBox::Slot()
+            .FillWidth(1.f)
+            .VAlign(VAlign_Center)
+            .Padding(4.f, 0.f)
+            [
+                SNew(SSlider)
+                .Value(this, &SDebugPrintReplay::GetSliderValue)
+                .OnValueChanged(this, &SDebugPrintReplay::OnSliderValueChanged)
+            ]
+            + SHorizontalBox::Slot()
+            .AutoWidth()
+            [
+                SNew(SButton)
+                .Text(LOCTEXT("NextFrame", ">"))
+                .OnClicked(this, &SDebugPrintReplay::OnStepClicked, 1)
+            ]
+            + SHorizontalBox::Slot()
+            .AutoWidth()
+            .VAlign(VAlign_Center)
+            .Padding(8.f, 0.f)
+            [
+                SNew(STextBlock)
+                .Text(this, &SDebugPrintReplay::GetFrameText)
+            ]
+        ]
+        + SVerticalBox::Slot()
+        .AutoHeight()
+        .Padding(4.f)
+        [
+            SNew(STextBlock)
+            .Text_Lambda([this]() { return StatusText; })
+        ]
+        + SVerticalBox::Slot()
+        .FillHeight(1.f)
+        [
+            SNew(SScrollBox)
+            + SScrollBox::Slot()
+            [
+                SAssignNew(TablesBox, SVerticalBox)
+            ]
+        ]
+    ];
+}
+
+FReply SDebugPrintReplay::OnOpenClicked()
+{
+    FString Error;
+    if (!Reader.Open(PathBox->GetText().ToString(), Error))
+    {
+        StatusText = FText::FromString(Error);
+        Tables.Reset();
+        RebuildTables();
+        return FReply::Handled();
+    }
+
+    StatusText = FText::Format(LOCTEXT("Opened", "{0} nodes, frames {1} to {2}"), Reader.GetNodes().Num(),
+        FText::AsNumber(Reader.GetFirstFrame()), FText::AsNumber(Reader.GetLastFrame()));
+    Frame = Reader.GetFirstFrame();
+    Reader.Seek(Frame, Tables);
+    RebuildTables();
+    return FReply::Handled();
+}
+
+FReply SDebugPrintReplay::OnStepClicked(int32 Delta)
+{
+    if (Reader.IsOpen())
+    {
+        SetFrame(Delta < 0 ? Frame - FMath::Min<uint64>(Frame, -Delta) : Frame + Delta);
+    }
+    return FReply::Handled();
+}
+
+float SDebugPrintReplay::GetSliderValue() const
+{
+    const uint64 NumFrames = Reader.GetLastFrame() - Reader.GetFirstFrame();
+    return NumFrames > 0 ? static_cast<float>(double(Frame - Reader.GetFirstFrame()) / double(NumFrames)) : 0.f;
+}
+
+void SDebugPrintReplay::OnSliderValueChanged(float Value)
+{
+    const uint64 NumFrames = Reader.GetLastFrame() - Reader.GetFirstFrame();
+    SetFrame(Reader.GetFirstFrame() + static_cast<uint64>(FMath::RoundToDouble(double(Value) * double(NumFrames))));
+}
+
+FText SDebugPrintReplay::GetFrameText() const
+{
+    return Reader.IsOpen() ? FText::Format(LOCTEXT("Frame", "Frame {0}"), FText::AsNumber(Frame)) : FText::GetEmpty();
+}
+
+void SDebugPrintReplay::SetFrame(uint64 NewFrame)
+{
+    NewFrame = FMath::Clamp(NewFrame, Reader.GetFirstFrame(), Reader.GetLastFrame());
+    if (!Reader.IsOpen() || NewFrame == Frame)
+    {
+        return;
+    }
+
+    Frame = NewFrame;
+    Reader.Seek(Frame, Tables);
+    RebuildTables();
+}
+
+void SDebugPrintReplay::RebuildTables()
+{
+    TablesBox->ClearChildren();
+
+    const FSlateFontInfo Font = FCoreStyle::GetDefaultFontStyle("Mono", 9);
+    for (const FDebugPrintCaptureTable& Table : Tables)
+    {
+        TablesBox->AddSlot()
+        .AutoHeight()
+        .Padding(4.f, 8.f, 4.f, 2.f)
+        [
+            SNew(STextBlock)
+            .Font(FAppStyle::GetFontStyle("BoldFont"))
+            .Text(FText::Format(LOCTEXT("TableHeader", "{0}  (frame {1}, {2} s)"), FText::FromString(Table.NodeGuid.ToString()),
+                FText::AsNumber(Table.Frame), FText::AsNumber(Table.Time)))
+        ];
+
+        for (int32 Row = 0; Row < Table.Values.Num(); ++Row)
+        {
+            TablesBox->AddSlot()
+            .AutoHeight()
+            .Padding(12.f, 0.f, 4.f, 0.f)
+            [
+                SNew(SHorizontalBox)
+                + SHorizontalBox::Slot()
+                .AutoWidth()
+                [
+                    SNew(SBox)
+                    .WidthOverride(240.f)
+                    [
+                        SNew(STextBlock)
+                        .Font(Font)
+                        .Text(FText::FromString(Table.Labels[Row]))
+                    ]
+                ]
+                + SHorizontalBox::Slot()
+                .FillWidth(1.f)
+                [
+                    SNew(STextBlock)
+                    .Font(Font)
+                    .Text(FText::FromString(Table.Values[Row]))
+                ]
+            ];
+        }
+    }
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,46 @@
+// Copyright MoxAlehin. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+#include "DebugPrintCaptureReader.h"
+
+class SEditableTextBox;
+class SVerticalBox;
+
+// Editor tab that opens a DebugPrint capture and scrubs through its frames, showing the table of every node
+// as it was on screen at the selected frame
+class SDebugPrintReplay : public SCompoundWidget
+{
+public:
+    SLATE_BEGIN_ARGS(SDebugPrintReplay) {}
+    SLATE_END_ARGS()
+
+    void Construct(const FArguments& InArgs);
+
+    static const FName TabName;
+
+    // Adds the tab to Window > Developer Tools
+    static void RegisterTabSpawner();
+    static void UnregisterTabSpawner();
+
+private:
+    FReply OnOpenClicked();
+    FReply OnStepClicked(int32 Delta);
+
+    float GetSliderValue() const;
+    void OnSliderValueChanged(float Value);
+    FText GetFrameText() const;
+
+    void SetFrame(uint64 NewFrame);
+    void RebuildTables();
+
+    FDebugPrintCaptureReader Reader;
+    TArray<FDebugPrintCaptureTable> Tables;
+    uint64 Frame = 0;
+    FText StatusText;
+
+    TSharedPtr<SEditableTextBox> PathBox;
+    TSharedPtr<SVerticalBox> TablesBox;
+};
@@ -0,0 +1,382 @@
+// Copyright MoxAlehin. All Rights Reserved.
+
+#include "SDebugPrintWatch.h"
+
+#include "Framework/Docking/TabManager.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "Styling/CoreStyle.h"
+#include "UObject/UObjectIterator.h"
+#include "Widgets/Docking/SDockTab.h"
+#include "Widgets/Input/SCheckBox.h"
+#include "Widgets/Input/SSearchBox.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Widgets/Views/SExpanderArrow.h"
+#include "Widgets/Views/SHeaderRow.h"
+#include "Widgets/Views/STableRow.h"
+#include "WorkspaceMenuStructure.h"
+#include "WorkspaceMenuStructureModule.h"
+#include "DebugPrintWatch.h"
+#include "K2Node_DebugPrint.h"
+
+#define LOCTEXT_NAMESPACE "SDebugPrintWatch"
+
+const FName SDebugPrintWatch::TabName(TEXT("DebugPrintWatch"));
+const FName SDebugPrintWatch::NameColumn(TEXT("Name"));
+const FName SDebugPrintWatch::ValueColumn(TEXT("Value"));
+const FName SDebugPrintWatch::NodeColumn(TEXT("Node"));
+
+namespace DebugPrintWatch
+{
+    // The tree refreshes a few times per second at most, the lines would be unreadable any faster
+    constexpr double RefreshInterval = 0.1;
+
+    class SItemRow : public SMultiColumnTableRow<TSharedPtr<SDebugPrintWatch::FItem>>
+    {
+    public:
+        SLATE_BEGIN_ARGS(SItemRow) {}
+        SLATE_END_ARGS()
+
+        void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& OwnerTable,
+            TSharedPtr<SDebugPrintWatch::FItem> InItem)
+        {
+            Item = InItem;
+            SMultiColumnTableRow::Construct(FSuperRowType::FArguments(), OwnerTable);
+        }
+
+        virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& Column) override
+        {
+            if (Column == SDebugPrintWatch::NameColumn)
+            {
+                return SNew(SHorizontalBox)
+                    + SHorizontalBox::Slot()
+                    .AutoWidth()
+                    [
+                        SNew(SExpanderArrow, SharedThis(this))
+                    ]
+                    + SHorizontalBox::Slot()
+                    .FillWidth(1.f)
+                    .VAlign(VAlign_Center)
+                    [
+                        SNew(STextBlock)
+                        .Text_Lambda([Item = Item]() { return FText::FromString(Item->Name); })
+                        .Font(FCoreStyle::GetDefaultFontStyle(Item->IsGroup() ? "Bold" : "Regular", 9))
+                    ];
+            }
+            if (Column == SDebugPrintWatch::ValueColumn)
+            {
+                // Items are updated in place, so the row reads their text and color on every paint
+                return SNew(STextBlock)
+                    .Text_Lambda([Item = Item]() { return FText::FromString(Item->Value); })
+                    .Font(FCoreStyle::GetDefaultFontStyle("Mono", 9))
+                    .ColorAndOpacity_Lambda([Item = Item]()
+                    {
+                        return Item->IsGroup() ? FSlateColor::UseSubduedForeground() : FSlateColor(Item->Color);
+                    });
+            }
+            return SNew(STextBlock)
+                .Text(Item->NodeGuid.IsValid() ? FText::FromString(Item->NodeGuid.ToString()) : FText::GetEmpty())
+                .ColorAndOpacity(FSlateColor::UseSubduedForeground());
+        }
+
+    private:
+        TSharedPtr<SDebugPrintWatch::FItem> Item;
+    };
+}
+
+void SDebugPrintWatch::RegisterTabSpawner()
+{
+    FGlobalTabmanager::Get()->RegisterNomadTabSpawner(TabName, FOnSpawnTab::CreateLambda([](const FSpawnTabArgs&)
+        {
+            return SNew(SDockTab).TabRole(ETabRole::NomadTab)[SNew(SDebugPrintWatch)];
+        }))
+        .SetDisplayName(LOCTEXT("TabTitle", "Debug Watch"))
+        .SetTooltipText(LOCTEXT("TabTooltip", "Lists the values printed by DebugPrint nodes while the game runs."))
+        .SetGroup(WorkspaceMenu::GetMenuStructure().GetDeveloperToolsDebugCategory());
+}
+
+void SDebugPrintWatch::UnregisterTabSpawner()
+{
+    FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(TabName);
+}
+
+SDebugPrintWatch::~SDebugPrintWatch()
+{
+    FDebugPrintWatch::Get().RemoveWatcher();
+}
+
+void SDebugPrintWatch::Construct(const FArguments& InArgs)
+{
+    FDebugPrintWatch::Get().AddWatcher();
+
+    ChildSlot
+    [
+        SNew(SVerticalBox)
+        + SVerticalBox::Slot()
+        .AutoHeight()
+        .Padding(4.f)
+        [
+            SNew(SHorizontalBox)
+            + SHorizontalBox::Slot()
+            .FillWidth(1.f)
+            [
+                SNew(SSearchBox)
+                .HintText(LOCTEXT("SearchHint", "Search Blueprints, instances, labels and values"))
+                .OnTextChanged(this, &SDebugPrintWatch::OnSearchTextChanged)
+            ]
+            + SHorizontalBox::Slot()
+            .AutoWidth()
+            .VAlign(VAlign_Center)
+            .Padding(8.f, 0.f, 0.f, 0.f)
+            [
+                SNew(SCheckBox)
+                .IsChecked_Lambda([this]() { return bPaused ? ECheckBoxState::Checked : ECheckBoxState::Unchecked; })
+                .OnCheckStateChanged_Lambda([this](ECheckBoxState State) { bPaused = State == ECheckBoxState::Checked; })
+                [
+                    SNew(STextBlock).Text(LOCTEXT("Pause", "Pause"))
+                ]
+            ]
+        ]
+        + SVerticalBox::Slot()
+        .FillHeight(1.f)
+        [
+            SAssignNew(TreeView, STreeView<TSharedPtr<FItem>>)
+            .TreeItemsSource(&RootItems)
+            .SelectionMode(ESelectionMode::Single)
+            .OnGenerateRow(this, &SDebugPrintWatch::OnGenerateRow)
+            .OnGetChildren(this, &SDebugPrintWatch::OnGetChildren)
+            .OnExpansionChanged(this, &SDebugPrintWatch::OnExpansionChanged)
+            .OnMouseButtonDoubleClick(this, &SDebugPrintWatch::OnItemDoubleClicked)
+            .HeaderRow
+            (
+                SNew(SHeaderRow)
+                + SHeaderRow::Column(NameColumn)
+                .DefaultLabel(LOCTEXT("NameColumn", "Name"))
+                .FillWidth(0.3f)
+                .SortMode(this, &SDebugPrintWatch::GetSortMode, NameColumn)
+                .OnSort(this, &SDebugPrintWatch::OnSortModeChanged)
+                + SHeaderRow::Column(ValueColumn)
+                .DefaultLabel(LOCTEXT("ValueColumn", "Value"))
+                .FillWidth(0.5f)
+                .SortMode(this, &SDebugPrintWatch::GetSortMode, ValueColumn)
+                .OnSort(this, &SDebugPrintWatch::OnSortModeChanged)
+                + SHeaderRow::Column(NodeColumn)
+                .DefaultLabel(LOCTEXT("NodeColumn", "Node"))
+                .FillWidth(0.2f)
+                .SortMode(this, &SDebugPrintWatch::GetSortMode, NodeColumn)
+                .OnSort(this, &SDebugPrintWatch::OnSortModeChanged)
+            )
+        ]
+    ];
+}
+
+void SDebugPrintWatch::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+    SCompoundWidget::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
+
+    if (bPaused || InCurrentTime - LastRefreshTime < DebugPrintWatch::RefreshInterval)
+    {
+        return;
+    }
+    LastRefreshTime = InCurrentTime;
+    Rebuild();
+}
+
+TSharedRef<ITableRow> SDebugPrintWatch::OnGenerateRow(TSharedPtr<FItem> Item, const TSharedRef<STableViewBase>& OwnerTable)
+{
+    return SNew(DebugPrintWatch::SItemRow, OwnerTable, Item);
+}
+
+void SDebugPrintWatch::OnGetChildren(TSharedPtr<FItem> Item, TArray<TSharedPtr<FItem>>& OutChildren)
+{
+    OutChildren = Item->Children;
+}
+
+void SDebugPrintWatch::OnExpansionChanged(TSharedPtr<FItem> Item, bool bExpanded)
+{
+    if (Item->IsGroup())
+    {
+        if (bExpanded)
+        {
+            CollapsedGroups.Remove(Item->GroupPath);
+        }
+        else
+        {
+            CollapsedGroups.Add(Item->GroupPath);
+        }
+    }
+}
+
+void SDebugPrintWatch::OnItemDoubleClicked(TSharedPtr<FItem> Item)
+{
+    if (Item->IsGroup())
+    {
+        TreeView->SetItemExpansion(Item, !TreeView->IsItemExpanded(Item));
+    }
+    else if (Item->NodeGuid.IsValid())
+    {
+        JumpToNode(Item->NodeGuid);
+    }
+}
+
+void SDebugPrintWatch::OnSearchTextChanged(const FText& Text)
+{
+    SearchText = Text.ToString();
+    ShownFrame = MAX_uint64;
+    Rebuild();
+}
+
+EColumnSortMode::Type SDebugPrintWatch::GetSortMode(FName Column) const
+{
+    return Column == SortColumn ? SortMode : EColumnSortMode::None;
+}
+
+void SDebugPrintWatch::OnSortModeChanged(EColumnSortPriority::Type Priority, const FName& Column, EColumnSortMode::Type Mode)
+{
+    SortColumn = Column;
+    SortMode = Mode;
+    ShownFrame = MAX_uint64;
+    Rebuild();
+}
+
+void SDebugPrintWatch::Rebuild()
+{
+    // The snapshot is only held while the tree is built, so the game thread can reuse it for a later frame
+    TSharedPtr<const FDebugPrintWatchSnapshot, ESPMode::ThreadSafe> Snapshot = FDebugPrintWatch::Get().GetSnapshot();
+    if (!Snapshot.IsValid() || Snapshot->Frame == ShownFrame)
+    {
+        return;
+    }
+    ShownFrame = Snapshot->Frame;
+
+    const uint64 Frame = Snapshot->Frame;
+    auto FindOrAddGroup = [this, Frame](TArray<TSharedPtr<FItem>>& Items, const FString& Name, const FString& GroupPath)
+    {
+        TSharedPtr<FItem>& Group = Groups.FindOrAdd(GroupPath);
+        if (!Group.IsValid())
+        {
+            Group = MakeShared<FItem>();
+            Group->Name = Name;
+            Group->GroupPath = GroupPath;
+            Items.Add(Group);
+        }
+        Group->SeenFrame = Frame;
+        return Group;
+    };
+
+    TMap<TTuple<FString, FGuid, FString>, int32> NumLinesByKey;
+    for (const FDebugPrintWatchRow& Row : Snapshot->Rows)
+    {
+        if (!SearchText.IsEmpty() && !Row.Label.Contains(SearchText) && !Row.Value.Contains(SearchText) &&
+            !Row.Blueprint.Contains(SearchText) && !Row.Instance.Contains(SearchText))
+        {
+            continue;
+        }
+
+        TSharedPtr<FItem> BlueprintGroup = FindOrAddGroup(RootItems, Row.Blueprint, Row.Blueprint);
+        TSharedPtr<FItem> Parent = BlueprintGroup;
+        if (!Row.Instance.IsEmpty())
+        {
+            Parent = FindOrAddGroup(BlueprintGroup->Children, Row.Instance, Row.Blueprint / Row.Instance);
+        }
+
+        int32& Occurrence = NumLinesByKey.FindOrAdd(MakeTuple(Parent->GroupPath, Row.NodeGuid, Row.Label));
+        TSharedPtr<FItem>& Item = Lines.FindOrAdd(MakeTuple(Parent->GroupPath, Row.NodeGuid, Row.Label, Occurrence++));
+        if (!Item.IsValid())
+        {
+            Item = MakeShared<FItem>();
+            Item->Name = Row.Label;
+            Item->NodeGuid = Row.NodeGuid;
+            Parent->Children.Add(Item);
+        }
+        Item->Value = Row.Value;
+        Item->Color = Row.Color;
+        Item->SeenFrame = Frame;
+    }
+
+    // Drop what the snapshot no longer shows
+    auto IsGone = [Frame](const TSharedPtr<FItem>& Item) { return Item->SeenFrame != Frame; };
+    for (auto It = Groups.CreateIterator(); It; ++It)
+    {
+        if (IsGone(It.Value())) It.RemoveCurrent();
+    }
+    for (auto It = Lines.CreateIterator(); It; ++It)
+    {
+        if (IsGone(It.Value())) It.RemoveCurrent();
+    }
+    TFunction<void(TArray<TSharedPtr<FItem>>&)> RemoveGone = [&IsGone, &RemoveGone](TArray<TSharedPtr<FItem>>& Items)
+    {
+        Items.RemoveAll(IsGone);
+        for (const TSharedPtr<FItem>& Item : Items)
+        {
+            RemoveGone(Item->Children);
+        }
+    };
+    RemoveGone(RootItems);
+
+    // Groups show how many lines they hold, and every level is sorted on its own
+    TFunction<void(TArray<TSharedPtr<FItem>>&)> SortLevel = [this, &SortLevel](TArray<TSharedPtr<FItem>>& Items)
+    {
+        for (const TSharedPtr<FItem>& Item : Items)
+        {
+            if (Item->IsGroup())
+            {
+                SortLevel(Item->Children);
+                Item->Value = FText::Format(LOCTEXT("NumChildren", "{0} {0}|plural(one=entry,other=entries)"),
+                    Item->Children.Num()).ToString();
+                TreeView->SetItemExpansion(Item, !CollapsedGroups.Contains(Item->GroupPath));
+            }
+        }
+        SortItems(Items);
+    };
+    SortLevel(RootItems);
+
+    TreeView->RequestTreeRefresh();
+}
+
+void SDebugPrintWatch::SortItems(TArray<TSharedPtr<FItem>>& Items) const
+{
+    const bool bAscending = SortMode != EColumnSortMode::Descending;
+    const FName Column = SortColumn;
+    Items.StableSort([bAscending, Column](const TSharedPtr<FItem>& A, const TSharedPtr<FItem>& B)
+    {
+        int32 Result = 0;
+        if (Column == ValueColumn && A->Value.IsNumeric() && B->Value.IsNumeric())
+        {
+            // Numbers sort by value, everything else by text
+            const double ValueA = FCString::Atod(*A->Value);
+            const double ValueB = FCString::Atod(*B->Value);
+            Result = ValueA < ValueB ? -1 : (ValueA > ValueB ? 1 : 0);
+        }
+        else if (Column == ValueColumn)
+        {
+            Result = A->Value.Compare(B->Value, ESearchCase::IgnoreCase);
+        }
+        else if (Column == NodeColumn)
+        {
+            Result = A->NodeGuid < B->NodeGuid ? -1 : (B->NodeGuid < A->NodeGuid ? 1 : 0);
+        }
+        else
+        {
+            Result = A->Name.Compare(B->Name, ESearchCase::IgnoreCase);
+        }
+        return bAscending ? Result < 0 : Result > 0;
+    });
+}
+
+void SDebugPrintWatch::JumpToNode(const FGuid& NodeGuid)
+{
+    // Compiling copies nodes into temporary graphs, only the node in a Blueprint is the one to open
+    for (TObjectIterator<UK2Node_DebugPrint> It; It; ++It)
+    {
+        UK2Node_DebugPrint* Node = *It;
+        if (Node->NodeGuid == NodeGuid && !Node->HasAnyFlags(RF_ClassDefaultObject) &&
+            Node->GetOutermost() != GetTransientPackage() && FBlueprintEditorUtils::FindBlueprintForNode(Node))
+        {
+            FKismetEditorUtilities::BringKismetToFocusAttentionOnObject(Node);
+            return;
+        }
+    }
+}
+
+#undef LOCTEXT_NAMESPACE
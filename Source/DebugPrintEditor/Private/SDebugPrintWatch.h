@@ -0,0 +1,84 @@
+// Copyright MoxAlehin. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/STreeView.h"
+
+// Editor tab listing every line DebugPrint shows, grouped by Blueprint and instance. It reads the snapshot
+// FDebugPrintWatch publishes at the end of every frame, so it works while the overlay is hidden with DisableAllScreenMessages.
+// Double-clicking a line opens its node.
+class SDebugPrintWatch : public SCompoundWidget
+{
+public:
+    SLATE_BEGIN_ARGS(SDebugPrintWatch) {}
+    SLATE_END_ARGS()
+
+    // A Blueprint, an instance or a single line
+    struct FItem
+    {
+        FString Name;
+        FString Value;
+        FGuid NodeGuid;
+        FLinearColor Color = FLinearColor::White;
+
+        // Blueprint and instance names joined, so the expansion of a group survives refreshes
+        FString GroupPath;
+        TArray<TSharedPtr<FItem>> Children;
+
+        // Snapshot frame the item was last part of. Items missing from the latest snapshot are removed
+        uint64 SeenFrame = 0;
+
+        bool IsGroup() const { return !GroupPath.IsEmpty(); }
+    };
+
+    static const FName TabName;
+    static const FName NameColumn;
+    static const FName ValueColumn;
+    static const FName NodeColumn;
+
+    // Adds the tab to Window > Developer Tools
+    static void RegisterTabSpawner();
+    static void UnregisterTabSpawner();
+
+    virtual ~SDebugPrintWatch() override;
+
+    void Construct(const FArguments& InArgs);
+    virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+
+private:
+    TSharedRef<ITableRow> OnGenerateRow(TSharedPtr<FItem> Item, const TSharedRef<STableViewBase>& OwnerTable);
+    void OnGetChildren(TSharedPtr<FItem> Item, TArray<TSharedPtr<FItem>>& OutChildren);
+    void OnExpansionChanged(TSharedPtr<FItem> Item, bool bExpanded);
+    void OnItemDoubleClicked(TSharedPtr<FItem> Item);
+    void OnSearchTextChanged(const FText& Text);
+
+    EColumnSortMode::Type GetSortMode(FName Column) const;
+    void OnSortModeChanged(EColumnSortPriority::Type Priority, const FName& Column, EColumnSortMode::Type Mode);
+
+    // Updates the groups from the latest snapshot, keeping the lines that match the search. Items that are still shown
+    // are updated in place, so the selection and expansion stay on them
+    void Rebuild();
+    void SortItems(TArray<TSharedPtr<FItem>>& Items) const;
+
+    // Opens the Blueprint editor at the node with the GUID
+    static void JumpToNode(const FGuid& NodeGuid);
+
+    TSharedPtr<STreeView<TSharedPtr<FItem>>> TreeView;
+    TArray<TSharedPtr<FItem>> RootItems;
+
+    // Every item shown, by group path and by group path, node and label. The last key field tells apart lines a node
+    // prints more than once with the same label
+    TMap<FString, TSharedPtr<FItem>> Groups;
+    TMap<TTuple<FString, FGuid, FString, int32>, TSharedPtr<FItem>> Lines;
+    TSet<FString> CollapsedGroups;
+
+    FString SearchText;
+    FName SortColumn = NameColumn;
+    EColumnSortMode::Type SortMode = EColumnSortMode::Ascending;
+    bool bPaused = false;
+
+    uint64 ShownFrame = MAX_uint64;
+    double LastRefreshTime = 0.0;
+};
@@ -0,0 +1,74 @@
+// Copyright MoxAlehin. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "DebugPrintTypes.h"
+#include "DebugPrintBenchmarkCommandlet.generated.h"
+
+// Struct without a special case in the formatter, printed field by field through reflection
+USTRUCT()
+struct FDebugPrintBenchmarkStruct
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    float Speed = 600.f;
+
+    UPROPERTY()
+    int32 Count = 3;
+
+    UPROPERTY()
+    FName Tag = TEXT("Benchmark");
+
+    UPROPERTY()
+    bool bActive = true;
+};
+
+// Measures the runtime cost of printing for every print type with 1 to 64 values and short and long labels.
+// Reports nanoseconds, heap allocations and allocated bytes per call and writes them as JSON for nightly runs:
+//
+//   UnrealEditor-Cmd <Project> -run=DebugPrintBenchmark -nullrhi [-Iterations=1000] [-Output=<Path>.json]
+UCLASS()
+class DEBUGPRINTEDITOR_API UDebugPrintBenchmarkCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UDebugPrintBenchmarkCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+
+private:
+    // Values printed by the benchmark, read through reflection like the values of a Blueprint frame
+    UPROPERTY()
+    float FloatValue = 3.14159f;
+
+    UPROPERTY()
+    int32 IntValue = 42;
+
+    UPROPERTY()
+    bool bBoolValue = true;
+
+    UPROPERTY()
+    FVector VectorValue = FVector(1.f, 2.f, 3.f);
+
+    UPROPERTY()
+    FString StringValue = TEXT("Benchmark");
+
+    UPROPERTY()
+    TEnumAsByte<EPrintType> EnumValue = EPrintType::PrintGraph;
+
+    UPROPERTY()
+    FName NameValue = TEXT("Benchmark");
+
+    UPROPERTY()
+    FText TextValue = FText::FromString(TEXT("Benchmark"));
+
+    UPROPERTY()
+    TArray<int32> ArrayValue = {1, 2, 3, 4, 5, 6, 7, 8};
+
+    UPROPERTY()
+    FDebugPrintBenchmarkStruct StructValue;
+};
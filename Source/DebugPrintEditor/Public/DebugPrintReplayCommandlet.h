@@ -0,0 +1,22 @@
+// Copyright MoxAlehin. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "DebugPrintReplayCommandlet.generated.h"
+
+// Plays a DebugPrint capture back without running the game. Logs the frame range and nodes of the capture, then the
+// table of every node as it was shown at the given frames:
+//
+//   UnrealEditor-Cmd <Project> -run=DebugPrintReplay -Capture=<Path>.dprec [-Frame=<N>] [-Count=<N>] [-Step=<N>]
+UCLASS()
+class DEBUGPRINTEDITOR_API UDebugPrintReplayCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UDebugPrintReplayCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,143 @@
+// Copyright MoxAlehin. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "K2Node.h"
+#include "K2Node_EditablePinBase.h"
+#include "DebugPrintFormatter.h"
+#include "DebugPrintTypes.h"
+#include "K2Node_DebugPrint.generated.h"
+
+UCLASS()
+class DEBUGPRINTEDITOR_API UK2Node_DebugPrint : public UK2Node_EditablePinBase
+{
+    GENERATED_BODY()
+
+public:
+    // Adds an array of strings for labeling the values
+    UPROPERTY(EditAnywhere, Category = "Settings")
+    TArray<FString> ValueLabels;
+
+    // Category of the node, used to switch nodes on and off with DebugPrint.Filter and to keep selected nodes when stripping
+    UPROPERTY(EditAnywhere, Category = "Settings")
+    FName Category;
+
+    // Precision and width of every number printed by the node
+    UPROPERTY(EditAnywhere, Category = "Formatting")
+    FDebugPrintNumberFormat NumberFormat;
+
+    // Number formats of single values by their label, used instead of the format of the node
+    UPROPERTY(EditAnywhere, Category = "Formatting")
+    TMap<FString, FDebugPrintNumberFormat> LabelNumberFormats;
+
+    // Maximum number of prints per second for each object, 0 means unlimited
+    UPROPERTY(EditAnywhere, Category = "Throttling", meta = (ClampMin = "0", Units = "Hz"))
+    float MaxUpdateRate = 0.f;
+
+    // Print only on every Nth execution for each object
+    UPROPERTY(EditAnywhere, Category = "Throttling", meta = (ClampMin = "1"))
+    int32 PrintEveryNth = 1;
+
+    // Chance that an execution prints
+    UPROPERTY(EditAnywhere, Category = "Throttling", meta = (ClampMin = "0", ClampMax = "1"))
+    float SampleChance = 1.f;
+
+    // Formats and shows only the values that changed since the last execution for the same object.
+    // Unchanged output stays on screen without being formatted again
+    UPROPERTY(EditAnywhere, Category = "Throttling")
+    bool bPrintOnChange = false;
+
+    // UObject interface
+    virtual void PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent) override;
+    // End of UObject interface
+
+    // Begin UEdGraphNode Interface
+    virtual void AllocateDefaultPins() override;
+    virtual void NodeConnectionListChanged() override;
+
+    virtual FLinearColor GetNodeTitleColor() const override;
+    virtual bool ShouldShowNodeProperties() const override { return true; }
+    virtual FText GetNodeTitle(ENodeTitleType::Type TitleType) const override;
+    virtual FName GetCornerIcon() const override;
+    virtual FText GetTooltipText() const override;
+    virtual FSlateIcon GetIconAndTint(FLinearColor& OutColor) const override;
+    // End of UEdGraphNode Interface
+
+    // Begin UK2Node Interface
+    virtual void ExpandNode(class FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph) override;
+    virtual void NotifyPinConnectionListChanged(UEdGraphPin* Pin) override;
+    virtual void PostReconstructNode() override;
+    virtual void ReallocatePinsDuringReconstruction(TArray<UEdGraphPin*>& OldPins) override;
+    virtual void GetNodeContextMenuActions(class UToolMenu* Menu, class UGraphNodeContextMenuContext* Context) const override;
+    virtual int32 GetNodeRefreshPriority() const override { return EBaseNodeRefreshPriority::Low_UsesDependentWildcard; }
+
+    virtual FText GetMenuCategory() const override;
+    virtual void GetMenuActions(FBlueprintActionDatabaseRegistrar& ActionRegistrar) const override;
+    // End of UK2Node Interface
+
+    // Begin UK2Node_EditablePinBase Interface
+    virtual bool ShouldUseConstRefParams() const override { return true; }
+    virtual UEdGraphPin* CreatePinFromUserDefinition(const TSharedPtr<FUserPinInfo> NewPinInfo) override;
+    virtual bool CanCreateUserDefinedPin(
+        const FEdGraphPinType& InPinType, EEdGraphPinDirection InDesiredDirection, FText& OutErrorMessage) override;
+    // End of UK2Node_EditablePinBase Interface
+
+    virtual void RemoveInputPin(UEdGraphPin* PinToRemove);
+    TArray<UEdGraphPin*> GetValuePins() const;
+
+    // Value pins are named Value_<Index>, returns INDEX_NONE for any other pin
+    static int32 GetValuePinIndex(const UEdGraphPin* Pin);
+    static FName GetValuePinName(int32 Index);
+
+private:
+    // Creates the value pin for the label at the index and places it after the other value pins
+    UEdGraphPin* CreateValuePin(int32 Index, const FEdGraphPinType& PinType);
+
+    void ResetPinToWildcard(UEdGraphPin* PinToReset);
+    void AddStringPin();
+    void OnValueLabelsChange();
+    void MakeLabelsUnique();
+
+    // Renames the label at the index if another value uses it already
+    void MakeLabelUnique(int32 Index);
+    static void SplitStringAndNumber(const FString& InputString, FString& OutString, int32& OutNumber);
+
+    // Returns the label of the value, or a generated one when the label is empty
+    FString GetValueLabel(int32 Index) const;
+
+    // Builds the label prefix of every value for the print type and separator set on the node
+    TArray<FString> BuildLabelPrefixes(bool& bOutSeparatorInLayout) const;
+
+    // Returns the text of an unlinked value pin, with typed in numbers already in the number format
+    static FString FormatLiteral(const UEdGraphPin* ValuePin, const FDebugPrintNumberFormat& Format);
+
+    // Compiles the node to a plain exec wire, leaving its values unevaluated
+    void ExpandAsPassThrough();
+
+    // Inserts the throttle gate in front of the print call and returns the exec pin that enters the node
+    UEdGraphPin* ExpandThrottleGate(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph, UEdGraphPin* PrintExecPin,
+        bool& bIsErrorFree);
+
+    // Inserts the DebugPrint.Enable and DebugPrint.Filter check in front of the node and returns the exec pin that enters it
+    UEdGraphPin* ExpandCategoryGate(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph, UEdGraphPin* NodeExecPin,
+        bool& bIsErrorFree);
+
+    // Returns the pin that passes the value to the print call, converting user structs with their ToString autocast
+    UEdGraphPin* ExpandValuePin(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph, UEdGraphPin* ValuePin,
+        bool& bIsErrorFree);
+
+    // Returns whether the print call can read the value of the pin by address
+    static bool HasAddress(const UEdGraphPin* SourcePin);
+
+    // Copies values without an address, like Self and literals, into a local assigned in front of the print call.
+    // Returns the pin to pass to the print call and moves InOutPrintExecPin to the first assignment
+    UEdGraphPin* ExpandLocalVariable(FKismetCompilerContext& CompilerContext, UEdGraph* SourceGraph, UEdGraphPin* ValuePin,
+        UEdGraphPin* SourcePin, UEdGraphPin*& InOutPrintExecPin, bool& bIsErrorFree);
+
+    // Helper method to get smart label from connected pin
+    FString GetSmartLabelFromPin(UEdGraphPin* Pin) const;
+
+    // Set when pins were removed, retyped or relabeled, so the node is redrawn once the connection change is done
+    bool bPinsChanged = false;
+};